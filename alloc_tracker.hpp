@@ -0,0 +1,105 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_FIXTURES_ALLOC_TRACKER_HPP
+#define INDEX_FIXTURES_ALLOC_TRACKER_HPP
+
+// C++ standard libraries
+#include <cstddef>
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::index::test
+{
+/*######################################################################################
+ * Classes for tracking allocations
+ *####################################################################################*/
+
+/**
+ * @brief The number and total bytes of memory allocations.
+ *
+ */
+struct AllocationStats {
+  /// the number of allocations.
+  size_t count{0};
+
+  /// the total bytes of allocations.
+  size_t bytes{0};
+
+  auto
+  operator-(const AllocationStats &rhs) const  //
+      -> AllocationStats
+  {
+    return {count - rhs.count, bytes - rhs.bytes};
+  }
+};
+
+/// per-thread statistics of allocations (updated by `alloc_tracker_main.hpp`).
+inline thread_local AllocationStats tls_alloc_stats{};
+
+/// per-thread statistics at the last lap.
+inline thread_local AllocationStats tls_alloc_lap{};
+
+/*######################################################################################
+ * Utility functions for tracking allocations
+ *####################################################################################*/
+
+/**
+ * @param size the size of an allocated region.
+ */
+inline void
+RecordAllocation(const size_t size) noexcept
+{
+  ++tls_alloc_stats.count;
+  tls_alloc_stats.bytes += size;
+}
+
+/**
+ * @return the statistics of allocations by this thread.
+ */
+inline auto
+GetAllocationStats() noexcept  //
+    -> AllocationStats
+{
+  return tls_alloc_stats;
+}
+
+/**
+ * @brief Start a new lap of allocations by this thread.
+ *
+ */
+inline void
+RestartAllocationLap() noexcept
+{
+  tls_alloc_lap = tls_alloc_stats;
+}
+
+/**
+ * @return the statistics of allocations by this thread since the last lap.
+ */
+inline auto
+LapAllocations() noexcept  //
+    -> AllocationStats
+{
+  const auto &lap = tls_alloc_stats - tls_alloc_lap;
+  tls_alloc_lap = tls_alloc_stats;
+  return lap;
+}
+
+}  // namespace dbgroup::index::test
+
+#endif  // INDEX_FIXTURES_ALLOC_TRACKER_HPP
@@ -0,0 +1,213 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_FIXTURES_ALLOC_TRACKER_MAIN_HPP
+#define INDEX_FIXTURES_ALLOC_TRACKER_MAIN_HPP
+
+// Note: this header defines the replacement of global allocation functions, so it must
+// be included in exactly one translation unit of a test binary (e.g., the one with
+// `main`). The fixtures only include `alloc_tracker.hpp` for the counters.
+
+// C++ standard libraries
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// local sources
+#include "alloc_tracker.hpp"
+
+/*######################################################################################
+ * Replacement of global allocation functions
+ *####################################################################################*/
+
+#if DBGROUP_TEST_TRACK_ALLOCATIONS
+
+#if defined(__GLIBC__)
+
+// interpose the C allocation functions to track allocations in C-style indexes as well
+extern "C" {
+auto __libc_malloc(size_t) noexcept -> void *;
+auto __libc_calloc(size_t, size_t) noexcept -> void *;
+auto __libc_realloc(void *, size_t) noexcept -> void *;
+auto __libc_memalign(size_t, size_t) noexcept -> void *;
+void __libc_free(void *) noexcept;
+
+auto
+malloc(size_t size) noexcept  //
+    -> void *
+{
+  ::dbgroup::index::test::RecordAllocation(size);
+  return __libc_malloc(size);
+}
+
+auto
+calloc(size_t num, size_t size) noexcept  //
+    -> void *
+{
+  ::dbgroup::index::test::RecordAllocation(num * size);
+  return __libc_calloc(num, size);
+}
+
+auto
+realloc(void *ptr, size_t size) noexcept  //
+    -> void *
+{
+  ::dbgroup::index::test::RecordAllocation(size);
+  return __libc_realloc(ptr, size);
+}
+
+auto
+aligned_alloc(size_t alignment, size_t size) noexcept  //
+    -> void *
+{
+  ::dbgroup::index::test::RecordAllocation(size);
+  return __libc_memalign(alignment, size);
+}
+
+auto
+posix_memalign(void **ptr, size_t alignment, size_t size) noexcept  //
+    -> int
+{
+  ::dbgroup::index::test::RecordAllocation(size);
+  *ptr = __libc_memalign(alignment, size);
+  return (*ptr == nullptr) ? ENOMEM : 0;
+}
+
+void
+free(void *ptr) noexcept
+{
+  __libc_free(ptr);
+}
+}  // extern "C"
+
+#define DBGROUP_TEST_ALLOCATE(size) std::malloc(size)
+#define DBGROUP_TEST_ALIGNED_ALLOCATE(align, size) std::aligned_alloc(align, size)
+
+#else
+
+// only C++ allocations are tracked without glibc
+#define DBGROUP_TEST_ALLOCATE(size) \
+  (::dbgroup::index::test::RecordAllocation(size), std::malloc(size))
+#define DBGROUP_TEST_ALIGNED_ALLOCATE(align, size) \
+  (::dbgroup::index::test::RecordAllocation(size), std::aligned_alloc(align, size))
+
+#endif
+
+auto
+operator new(size_t size)  //
+    -> void *
+{
+  auto *ptr = DBGROUP_TEST_ALLOCATE((size > 0) ? size : 1);
+  if (ptr == nullptr) throw std::bad_alloc{};
+  return ptr;
+}
+
+auto
+operator new[](size_t size)  //
+    -> void *
+{
+  return ::operator new(size);
+}
+
+auto
+operator new(size_t size, const std::nothrow_t &) noexcept  //
+    -> void *
+{
+  return DBGROUP_TEST_ALLOCATE((size > 0) ? size : 1);
+}
+
+auto
+operator new[](size_t size, const std::nothrow_t &) noexcept  //
+    -> void *
+{
+  return DBGROUP_TEST_ALLOCATE((size > 0) ? size : 1);
+}
+
+auto
+operator new(size_t size, std::align_val_t align)  //
+    -> void *
+{
+  // aligned_alloc requires the size to be a multiple of the alignment
+  const auto alignment = static_cast<size_t>(align);
+  const auto aligned_size = (size + alignment - 1) / alignment * alignment;
+  auto *ptr = DBGROUP_TEST_ALIGNED_ALLOCATE(alignment, std::max(aligned_size, alignment));
+  if (ptr == nullptr) throw std::bad_alloc{};
+  return ptr;
+}
+
+auto
+operator new[](size_t size, std::align_val_t align)  //
+    -> void *
+{
+  return ::operator new(size, align);
+}
+
+void
+operator delete(void *ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete[](void *ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete(void *ptr, size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete[](void *ptr, size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete(void *ptr, std::align_val_t) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete[](void *ptr, std::align_val_t) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete(void *ptr, size_t, std::align_val_t) noexcept
+{
+  std::free(ptr);
+}
+
+void
+operator delete[](void *ptr, size_t, std::align_val_t) noexcept
+{
+  std::free(ptr);
+}
+
+#undef DBGROUP_TEST_ALLOCATE
+#undef DBGROUP_TEST_ALIGNED_ALLOCATE
+
+#endif  // DBGROUP_TEST_TRACK_ALLOCATIONS
+
+#endif  // INDEX_FIXTURES_ALLOC_TRACKER_MAIN_HPP
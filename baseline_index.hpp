@@ -0,0 +1,518 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_FIXTURES_BASELINE_INDEX_HPP
+#define INDEX_FIXTURES_BASELINE_INDEX_HPP
+
+// C++ standard libraries
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::index::test
+{
+/*######################################################################################
+ * Class definition
+ *####################################################################################*/
+
+/**
+ * @brief A reference index for comparison and validation.
+ *
+ * This index is a `std::map` protected by a reader-writer lock, and each key has a list
+ * of versions tagged with epochs. A snapshot at a protected epoch sees versions written
+ * in earlier epochs. This index does not copy variable-length data, so keys and payloads
+ * must outlive the index, and old versions are never reclaimed.
+ *
+ * @tparam Key a class of stored keys.
+ * @tparam Payload a class of stored payloads.
+ * @tparam Comp a class for ordering keys.
+ */
+template <class Key, class Payload, class Comp>
+class BaselineIndex
+{
+  /*####################################################################################
+   * Type aliases
+   *##################################################################################*/
+
+  using EpochManager = ::dbgroup::memory::EpochManager;
+  using ScanKey = std::optional<std::tuple<const Key &, size_t, bool>>;
+  using Bound = std::optional<std::pair<Key, bool>>;
+  using Versions = std::vector<std::pair<size_t, std::optional<Payload>>>;
+  using Map = std::map<Key, Versions, Comp>;
+
+  /*####################################################################################
+   * Internal constants
+   *##################################################################################*/
+
+  /// an epoch value for reading the latest versions.
+  static constexpr size_t kLatestEpoch = std::numeric_limits<size_t>::max();
+
+  /// the number of records that an iterator copies at once.
+  static constexpr size_t kPageSize = 256;
+
+ public:
+  /*####################################################################################
+   * Public classes
+   *##################################################################################*/
+
+  /**
+   * @brief An iterator that copies records page by page.
+   *
+   * The lock of an index is only held while copying a page, so a thread can modify the
+   * index during its own scan.
+   */
+  class RecordIterator
+  {
+   public:
+    /*##################################################################################
+     * Public constructors and assignment operators
+     *################################################################################*/
+
+    RecordIterator(  //
+        const BaselineIndex *index,
+        const size_t epoch,
+        const bool descending,
+        Bound from,
+        Bound to)
+        : index_{index}, epoch_{epoch}, descending_{descending}, from_{from}, to_{to}
+    {
+      Fill();
+    }
+
+    /*##################################################################################
+     * Public operators
+     *################################################################################*/
+
+    explicit operator bool() const { return pos_ < records_.size(); }
+
+    auto
+    operator++()  //
+        -> RecordIterator &
+    {
+      ++pos_;
+      if (pos_ == records_.size() && has_more_) {
+        Fill();
+      }
+      return *this;
+    }
+
+    auto
+    operator*() const  //
+        -> std::pair<Key, Payload>
+    {
+      return records_[pos_];
+    }
+
+    /*##################################################################################
+     * Public utility functions
+     *################################################################################*/
+
+    /**
+     * @brief Move this iterator to a given key without changing the other end.
+     *
+     * @param key a tuple of a key, its length, and a flag for including it.
+     */
+    template <class ScanKeyTuple>
+    void
+    Seek(const ScanKeyTuple &key)
+    {
+      const auto &[k, len, closed] = key;
+      from_.emplace(k, closed);
+      Fill();
+    }
+
+   private:
+    /*##################################################################################
+     * Internal utility functions
+     *################################################################################*/
+
+    void
+    Fill()
+    {
+      records_.clear();
+      pos_ = 0;
+      from_ = index_->CopyPage(epoch_, descending_, from_, to_, records_, has_more_);
+    }
+
+    /*##################################################################################
+     * Internal member variables
+     *################################################################################*/
+
+    /// a target index.
+    const BaselineIndex *index_{nullptr};
+
+    /// an epoch for reading versions.
+    size_t epoch_{kLatestEpoch};
+
+    /// a flag for reading records in descending order.
+    bool descending_{false};
+
+    /// a bound to start the next page.
+    Bound from_{};
+
+    /// a bound to finish scanning.
+    Bound to_{};
+
+    /// copied records in the current page.
+    std::vector<std::pair<Key, Payload>> records_{};
+
+    /// the position of the current record.
+    size_t pos_{0};
+
+    /// a flag indicating that more records may follow the current page.
+    bool has_more_{false};
+  };
+
+  /*####################################################################################
+   * Public constructors and assignment operators
+   *##################################################################################*/
+
+  /**
+   * @param epoch_manager an epoch manager for versioning.
+   * @param gc_interval_micro unused (for compatibility with the other indexes).
+   */
+  explicit BaselineIndex(  //
+      std::shared_ptr<EpochManager> epoch_manager,
+      [[maybe_unused]] const size_t gc_interval_micro = 0)
+      : epoch_manager_{std::move(epoch_manager)}
+  {
+  }
+
+  BaselineIndex(const BaselineIndex &) = delete;
+  BaselineIndex(BaselineIndex &&) = delete;
+
+  auto operator=(const BaselineIndex &) -> BaselineIndex & = delete;
+  auto operator=(BaselineIndex &&) -> BaselineIndex & = delete;
+
+  /*####################################################################################
+   * Public destructors
+   *##################################################################################*/
+
+  ~BaselineIndex() = default;
+
+  /*####################################################################################
+   * Public read APIs
+   *##################################################################################*/
+
+  auto
+  Read(  //
+      const Key &key,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    const std::shared_lock guard{mtx_};
+    const auto it = map_.find(key);
+    if (it == map_.end()) return std::nullopt;
+    return it->second.back().second;
+  }
+
+  template <class EpochGuard, class ProtectedEpochs>
+  auto
+  SnapshotRead(  //
+      const Key &key,
+      [[maybe_unused]] const EpochGuard &epoch_guard,
+      const ProtectedEpochs &protected_epochs,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    const std::shared_lock guard{mtx_};
+    const auto it = map_.find(key);
+    if (it == map_.end()) return std::nullopt;
+    return GetVisible(it->second, protected_epochs.front());
+  }
+
+  template <class EpochGuard>
+  auto
+  Scan([[maybe_unused]] const EpochGuard &epoch_guard)  //
+      -> RecordIterator
+  {
+    return RecordIterator{this, kLatestEpoch, false, std::nullopt, std::nullopt};
+  }
+
+  template <class EpochGuard, class ProtectedEpochs>
+  auto
+  Scan(  //
+      [[maybe_unused]] const EpochGuard &epoch_guard,
+      const ProtectedEpochs &protected_epochs,
+      const ScanKey &begin_key = std::nullopt,
+      const ScanKey &end_key = std::nullopt)  //
+      -> RecordIterator
+  {
+    const auto epoch = protected_epochs.front();
+    return RecordIterator{this, epoch, false, ToBound(begin_key), ToBound(end_key)};
+  }
+
+  template <class EpochGuard, class ProtectedEpochs>
+  auto
+  ReverseScan(  //
+      [[maybe_unused]] const EpochGuard &epoch_guard,
+      const ProtectedEpochs &protected_epochs,
+      const ScanKey &begin_key = std::nullopt,
+      const ScanKey &end_key = std::nullopt)  //
+      -> RecordIterator
+  {
+    const auto epoch = protected_epochs.front();
+    return RecordIterator{this, epoch, true, ToBound(end_key), ToBound(begin_key)};
+  }
+
+  /*####################################################################################
+   * Public write APIs
+   *##################################################################################*/
+
+  auto
+  Write(  //
+      const Key &key,
+      const Payload &payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key),
+      [[maybe_unused]] const size_t pay_len = sizeof(Payload))  //
+      -> int
+  {
+    const std::unique_lock guard{mtx_};
+    map_[key].emplace_back(epoch_manager_->GetCurrentEpoch(), payload);
+    return 0;
+  }
+
+  auto
+  Insert(  //
+      const Key &key,
+      const Payload &payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key),
+      [[maybe_unused]] const size_t pay_len = sizeof(Payload))  //
+      -> int
+  {
+    const std::unique_lock guard{mtx_};
+    auto &versions = map_[key];
+    if (!versions.empty() && versions.back().second) return 1;
+    versions.emplace_back(epoch_manager_->GetCurrentEpoch(), payload);
+    return 0;
+  }
+
+  auto
+  Update(  //
+      const Key &key,
+      const Payload &payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key),
+      [[maybe_unused]] const size_t pay_len = sizeof(Payload))  //
+      -> int
+  {
+    const std::unique_lock guard{mtx_};
+    const auto it = map_.find(key);
+    if (it == map_.end() || !it->second.back().second) return 1;
+    it->second.emplace_back(epoch_manager_->GetCurrentEpoch(), payload);
+    return 0;
+  }
+
+  auto
+  Delete(  //
+      const Key &key,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> int
+  {
+    const std::unique_lock guard{mtx_};
+    const auto it = map_.find(key);
+    if (it == map_.end() || !it->second.back().second) return 1;
+    it->second.emplace_back(epoch_manager_->GetCurrentEpoch(), std::nullopt);
+    return 0;
+  }
+
+  /**
+   * @param entries a forward range of tuple-like entries (i.e., a key and a payload).
+   * @param thread_num unused (entries are inserted sequentially).
+   * @return zero.
+   */
+  template <class Entries>
+  auto
+  Bulkload(  //
+      const Entries &entries,
+      [[maybe_unused]] const size_t thread_num = 1)  //
+      -> int
+  {
+    const std::unique_lock guard{mtx_};
+    const auto epoch = epoch_manager_->GetCurrentEpoch();
+    for (const auto &entry : entries) {
+      map_[std::get<0>(entry)].emplace_back(epoch, std::get<1>(entry));
+    }
+    return 0;
+  }
+
+ private:
+  /*####################################################################################
+   * Internal utility functions
+   *##################################################################################*/
+
+  static auto
+  ToBound(const ScanKey &key)  //
+      -> Bound
+  {
+    if (!key) return std::nullopt;
+    const auto &[k, len, closed] = *key;
+    return std::make_pair(k, closed);
+  }
+
+  static auto
+  GetVisible(  //
+      const Versions &versions,
+      const size_t epoch)  //
+      -> std::optional<Payload>
+  {
+    if (epoch == kLatestEpoch) return versions.back().second;
+    for (auto it = versions.rbegin(); it != versions.rend(); ++it) {
+      if (it->first < epoch) return it->second;
+    }
+    return std::nullopt;
+  }
+
+  /**
+   * @brief Copy visible records from a given bound to the other one.
+   *
+   * @param epoch an epoch for reading versions.
+   * @param descending a flag for reading records in descending order.
+   * @param from a bound to start copying.
+   * @param to a bound to finish copying.
+   * @param records a vector to store copied records.
+   * @param has_more a flag set if records may remain after copied ones.
+   * @return a bound to start the next page.
+   */
+  auto
+  CopyPage(  //
+      const size_t epoch,
+      const bool descending,
+      const Bound &from,
+      const Bound &to,
+      std::vector<std::pair<Key, Payload>> &records,
+      bool &has_more) const  //
+      -> Bound
+  {
+    const std::shared_lock guard{mtx_};
+
+    // check whether a key exceeds the end of a range
+    auto is_out = [&](const Key &key) -> bool {
+      if (!to) return false;
+      const auto &[bound, closed] = *to;
+      if (descending) return closed ? Comp{}(key, bound) : !Comp{}(bound, key);
+      return closed ? Comp{}(bound, key) : !Comp{}(key, bound);
+    };
+
+    Bound next = from;
+    has_more = false;
+    if (descending) {
+      auto it = map_.end();
+      if (from) {
+        const auto &[key, closed] = *from;
+        it = closed ? map_.upper_bound(key) : map_.lower_bound(key);
+      }
+      while (it != map_.begin()) {
+        --it;
+        if (is_out(it->first)) return next;
+        if (records.size() == kPageSize) {
+          has_more = true;
+          return next;
+        }
+        next.emplace(it->first, false);
+        if (const auto &payload = GetVisible(it->second, epoch); payload) {
+          records.emplace_back(it->first, *payload);
+        }
+      }
+    } else {
+      auto it = map_.begin();
+      if (from) {
+        const auto &[key, closed] = *from;
+        it = closed ? map_.lower_bound(key) : map_.upper_bound(key);
+      }
+      for (; it != map_.end(); ++it) {
+        if (is_out(it->first)) return next;
+        if (records.size() == kPageSize) {
+          has_more = true;
+          return next;
+        }
+        next.emplace(it->first, false);
+        if (const auto &payload = GetVisible(it->second, epoch); payload) {
+          records.emplace_back(it->first, *payload);
+        }
+      }
+    }
+    return next;
+  }
+
+  /*####################################################################################
+   * Internal member variables
+   *##################################################################################*/
+
+  /// an epoch manager for versioning.
+  std::shared_ptr<EpochManager> epoch_manager_{nullptr};
+
+  /// a mutex for concurrent accesses.
+  mutable std::shared_mutex mtx_{};
+
+  /// versions of records ordered by keys.
+  Map map_{};
+};
+
+/*######################################################################################
+ * Implementation status of the baseline index
+ *####################################################################################*/
+
+/**
+ * @brief A tag class to enable optional operations of `BaselineIndex`.
+ *
+ */
+struct BaselineImplStatus {
+};
+
+template <>
+constexpr auto
+HasStreamingBulkloadOperation<BaselineImplStatus>()  //
+    -> bool
+{
+  return true;
+}
+
+template <>
+constexpr auto
+HasReverseScanOperation<BaselineImplStatus>()  //
+    -> bool
+{
+  return true;
+}
+
+template <>
+constexpr auto
+HasIteratorSeekOperation<BaselineImplStatus>()  //
+    -> bool
+{
+  return true;
+}
+
+/**
+ * @tparam Key a class of keys with its comparator (e.g., `UInt8` and `Var`).
+ * @tparam Payload a class of payloads with its comparator.
+ */
+template <class Key, class Payload>
+using BaselineIndexInfo = IndexInfo<BaselineIndex, Key, Payload, BaselineImplStatus>;
+
+}  // namespace dbgroup::index::test
+
+#endif  // INDEX_FIXTURES_BASELINE_INDEX_HPP
@@ -18,14 +18,77 @@
 #define INDEX_FIXTURES_COMMON_HPP
 
 // C++ standard libraries
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
+// system libraries
+#include <sys/mman.h>
+
+// local sources
+#include "dataset.hpp"
+
+/*######################################################################################
+ * Default values of optional build options
+ *####################################################################################*/
+
+#ifndef DBGROUP_TEST_REPORT_METRICS
+#define DBGROUP_TEST_REPORT_METRICS 0
+#endif
+
+#ifndef DBGROUP_TEST_SAMPLING_INTERVAL_MS
+#define DBGROUP_TEST_SAMPLING_INTERVAL_MS 10
+#endif
+
+#ifndef DBGROUP_TEST_BENCH_MAX_KEY_NUM
+#define DBGROUP_TEST_BENCH_MAX_KEY_NUM 1E6
+#endif
+
+#ifndef DBGROUP_TEST_DATASET_DIR
+#define DBGROUP_TEST_DATASET_DIR ""
+#endif
+
+#ifndef DBGROUP_TEST_TRACK_ALLOCATIONS
+#define DBGROUP_TEST_TRACK_ALLOCATIONS 0
+#endif
+
+#ifndef DBGROUP_TEST_EXPECT_ALLOCATION_FREE_READS
+#define DBGROUP_TEST_EXPECT_ALLOCATION_FREE_READS 0
+#endif
+
+#ifndef DBGROUP_TEST_USE_HUGEPAGES
+#define DBGROUP_TEST_USE_HUGEPAGES 0
+#endif
+
+#ifndef DBGROUP_TEST_TRACE_FILE
+#define DBGROUP_TEST_TRACE_FILE ""
+#endif
+
+#ifndef DBGROUP_TEST_SLOW_OP_THRESHOLD_US
+#define DBGROUP_TEST_SLOW_OP_THRESHOLD_US 1000
+#endif
+
+#ifndef DBGROUP_TEST_PREFIX_DEPTH
+#define DBGROUP_TEST_PREFIX_DEPTH 3
+#endif
+
+#ifndef DBGROUP_TEST_PREFIX_FAN_OUT
+#define DBGROUP_TEST_PREFIX_FAN_OUT 10
+#endif
+
 /*######################################################################################
  * Classes for testing
  *####################################################################################*/
@@ -68,6 +131,106 @@ class MyClass
   uint64_t control_bits_ : 3;  // NOLINT
 };
 
+/**
+ * @brief A fixed-length class to evaluate the cost of copying large payloads.
+ *
+ * Every word holds the same value, so comparing instances checks the whole content.
+ *
+ * @tparam kSize the size of this class in bytes.
+ */
+template <size_t kSize>
+class FixedPayload
+{
+  static_assert(kSize > 0 && kSize % sizeof(uint64_t) == 0);
+
+ public:
+  constexpr FixedPayload() = default;
+  constexpr explicit FixedPayload(const uint64_t val)
+  {
+    for (auto &word : words_) {
+      word = val;
+    }
+  }
+
+  ~FixedPayload() = default;
+
+  constexpr FixedPayload(const FixedPayload &) = default;
+  constexpr FixedPayload(FixedPayload &&) noexcept = default;
+  constexpr auto operator=(const FixedPayload &) -> FixedPayload & = default;
+  constexpr auto operator=(FixedPayload &&) noexcept -> FixedPayload & = default;
+
+  // enable std::less to compare this class
+  auto
+  operator<(const FixedPayload &comp) const  //
+      -> bool
+  {
+    return words_ < comp.words_;
+  }
+
+ private:
+  std::array<uint64_t, kSize / sizeof(uint64_t)> words_{};
+};
+
+/**
+ * @brief A fixed-length binary key such as UUIDs and packed composite keys.
+ *
+ * Bytes are stored in big-endian order to be compared as `memcmp` does. Since an ID is
+ * written into the last eight bytes and the preceding bytes are zero, every comparison
+ * examines the whole key as with composite keys that share leading columns.
+ *
+ * @tparam kSize the size of this class in bytes.
+ */
+template <size_t kSize>
+class BinaryKey
+{
+  static_assert(kSize >= sizeof(uint64_t) && kSize % sizeof(uint64_t) == 0);
+
+ public:
+  constexpr BinaryKey() = default;
+  constexpr explicit BinaryKey(const uint64_t id) { words_.back() = ToBigEndian(id); }
+
+  ~BinaryKey() = default;
+
+  constexpr BinaryKey(const BinaryKey &) = default;
+  constexpr BinaryKey(BinaryKey &&) noexcept = default;
+  constexpr auto operator=(const BinaryKey &) -> BinaryKey & = default;
+  constexpr auto operator=(BinaryKey &&) noexcept -> BinaryKey & = default;
+
+  // enable std::less to compare this class word by word instead of byte by byte
+  auto
+  operator<(const BinaryKey &comp) const  //
+      -> bool
+  {
+    for (size_t i = 0; i < kWordNum; ++i) {
+      if (words_[i] != comp.words_[i]) {
+        return ToBigEndian(words_[i]) < ToBigEndian(comp.words_[i]);
+      }
+    }
+    return false;
+  }
+
+ private:
+  /// the number of words in this class.
+  static constexpr size_t kWordNum = kSize / sizeof(uint64_t);
+
+  /**
+   * @param word a word in native byte order.
+   * @return the word in big-endian order (swapping bytes is an involution).
+   */
+  static constexpr auto
+  ToBigEndian(const uint64_t word)  //
+      -> uint64_t
+  {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return __builtin_bswap64(word);
+#else
+    return word;
+#endif
+  }
+
+  std::array<uint64_t, kWordNum> words_{};
+};
+
 namespace dbgroup::index::test
 {
 /*######################################################################################
@@ -80,6 +243,12 @@ enum AccessPattern {
   kRandom,
 };
 
+enum PrefixPattern {
+  kURLPath,
+  kComposite,
+  kEmail,
+};
+
 enum WriteOperation {
   kWrite,
   kInsert,
@@ -94,6 +263,29 @@ constexpr size_t kRandomSeed = DBGROUP_TEST_RANDOM_SEED;
 
 constexpr size_t kVarDataLength = 18;
 
+constexpr bool kReportMetrics = DBGROUP_TEST_REPORT_METRICS;
+
+constexpr size_t kSamplingIntervalMilli = DBGROUP_TEST_SAMPLING_INTERVAL_MS;
+
+constexpr std::string_view kDatasetDir = DBGROUP_TEST_DATASET_DIR;
+
+constexpr bool kTrackAllocations = DBGROUP_TEST_TRACK_ALLOCATIONS;
+
+constexpr bool kExpectAllocationFreeReads =
+    kTrackAllocations && DBGROUP_TEST_EXPECT_ALLOCATION_FREE_READS;
+
+constexpr bool kUseHugePages = DBGROUP_TEST_USE_HUGEPAGES;
+
+constexpr std::string_view kTraceFile = DBGROUP_TEST_TRACE_FILE;
+
+constexpr bool kTraceEvents = !kTraceFile.empty();
+
+constexpr size_t kSlowOpThresholdMicro = DBGROUP_TEST_SLOW_OP_THRESHOLD_US;
+
+constexpr size_t kPrefixDepth = DBGROUP_TEST_PREFIX_DEPTH;
+
+constexpr size_t kPrefixFanOut = DBGROUP_TEST_PREFIX_FAN_OUT;
+
 constexpr bool kExpectSuccess = true;
 
 constexpr bool kExpectFailed = false;
@@ -110,6 +302,12 @@ constexpr bool kWithWrite = true;
 
 constexpr bool kWithDelete = true;
 
+constexpr bool kStreaming = true;
+
+constexpr bool kDescending = true;
+
+constexpr bool kRenewSnapshot = true;
+
 /*######################################################################################
  * Global utility classes
  *####################################################################################*/
@@ -188,16 +386,153 @@ CreateDummyString(  //
   }
 }
 
+/**
+ * @brief Create strings that share prefixes as URL paths, composite keys, or e-mails.
+ *
+ * Prefixes form a tree of `depth` levels with `fan_out` branches at each level, and
+ * strings are evenly assigned to its leaves. Since every component has a fixed width,
+ * the created strings are sorted in ascending order of their IDs.
+ *
+ * @param data_num the number of strings.
+ * @param pattern the pattern of strings.
+ * @param depth the number of shared components before the last one.
+ * @param fan_out the number of branches at each level.
+ * @return the created strings.
+ */
+inline auto
+CreatePrefixStrings(  //
+    const size_t data_num,
+    const PrefixPattern pattern,
+    const size_t depth,
+    const size_t fan_out)  //
+    -> std::vector<std::string>
+{
+  constexpr std::array<std::string_view, 4> kURLWords{"category", "section", "topic", "page"};
+  constexpr std::array<std::string_view, 4> kCompositeWords{"tenant", "table", "index", "part"};
+  constexpr std::array<std::string_view, 4> kEmailWords{"given", "family", "team", "dept"};
+
+  auto pad = [](const size_t val, const size_t width) -> std::string {
+    auto str = std::to_string(val);
+    return std::string(width - std::min(width, str.size()), '0') + str;
+  };
+
+  size_t prefix_num = 1;
+  for (size_t l = 0; l < depth && prefix_num < data_num; ++l) {
+    prefix_num *= fan_out;
+  }
+  const auto leaf_num = (data_num + prefix_num - 1) / prefix_num;
+  const auto prefix_width = std::to_string(fan_out - 1).size();
+  const auto leaf_width = std::to_string(leaf_num - 1).size();
+
+  std::vector<std::string> data_vec{};
+  data_vec.reserve(data_num);
+  std::vector<size_t> components(depth);
+  for (size_t i = 0; i < data_num; ++i) {
+    auto prefix_id = i / leaf_num;
+    for (size_t l = depth; l > 0; --l) {
+      components[l - 1] = prefix_id % fan_out;
+      prefix_id /= fan_out;
+    }
+
+    std::string str{};
+    switch (pattern) {
+      case kURLPath:
+        str = "https://www.example.com";
+        for (size_t l = 0; l < depth; ++l) {
+          str += "/" + std::string{kURLWords[l % kURLWords.size()]};
+          str += pad(components[l], prefix_width);
+        }
+        str += "/item" + pad(i % leaf_num, leaf_width);
+        break;
+      case kComposite:
+        for (size_t l = 0; l < depth; ++l) {
+          str += std::string{kCompositeWords[l % kCompositeWords.size()]};
+          str += pad(components[l], prefix_width) + ":";
+        }
+        str += "row" + pad(i % leaf_num, leaf_width);
+        break;
+      case kEmail:
+        for (size_t l = 0; l < depth; ++l) {
+          str += std::string{kEmailWords[l % kEmailWords.size()]};
+          str += pad(components[l], prefix_width) + ".";
+        }
+        str += pad(i % leaf_num, leaf_width) + "@example.com";
+        break;
+    }
+    data_vec.emplace_back(std::move(str));
+  }
+
+  return data_vec;
+}
+
+/**
+ * @brief Create random alphanumeric strings with the same lengths as given ones.
+ *
+ * @param base_vec strings to be imitated.
+ * @return the created strings in ascending order.
+ */
+inline auto
+CreateRandomStrings(const std::vector<std::string> &base_vec)  //
+    -> std::vector<std::string>
+{
+  constexpr std::string_view kChars =
+      "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+  std::mt19937_64 rng{kRandomSeed};
+  std::uniform_int_distribution<size_t> char_dist{0, kChars.size() - 1};
+  std::vector<std::string> data_vec{};
+  data_vec.reserve(base_vec.size());
+  for (const auto &base : base_vec) {
+    std::string str(base.size(), '0');
+    for (auto &c : str) {
+      c = kChars[char_dist(rng)];
+    }
+    data_vec.emplace_back(std::move(str));
+  }
+  std::sort(data_vec.begin(), data_vec.end());
+
+  return data_vec;
+}
+
+/**
+ * @brief Advise the kernel to back a memory region with transparent hugepages.
+ *
+ * Only the hugepage-aligned part of the region is advised, and this function does nothing
+ * unless `DBGROUP_TEST_USE_HUGEPAGES` is enabled.
+ *
+ * @param addr the beginning address of a region.
+ * @param size the size of the region.
+ */
+inline void
+AdviseHugePages(  //
+    [[maybe_unused]] const void *addr,
+    [[maybe_unused]] const size_t size)
+{
+  if constexpr (kUseHugePages) {
+    constexpr uintptr_t kHugePageSize = 2UL << 20UL;
+    constexpr uintptr_t kMask = ~(kHugePageSize - 1);
+
+    const auto head = reinterpret_cast<uintptr_t>(addr);
+    const auto begin = (head + kHugePageSize - 1) & kMask;
+    const auto end = (head + size) & kMask;
+    if (begin < end) {
+      madvise(reinterpret_cast<void *>(begin), end - begin, MADV_HUGEPAGE);
+    }
+  }
+}
+
 template <class T>
 auto
-PrepareTestData(const size_t data_num)  //
+CreateTestData(const size_t data_num)  //
     -> std::vector<T>
 {
   std::vector<T> data_vec{};
   data_vec.reserve(data_num);
+  AdviseHugePages(data_vec.data(), sizeof(T) * data_num);
 
   if constexpr (std::is_same_v<T, char *>) {
     auto *var_arr = new VarData[data_num];
+    AdviseHugePages(var_arr, sizeof(VarData) * data_num);
     VarData base{};
     memset(base.data, '0', kVarDataLength);
 
@@ -205,6 +540,7 @@ PrepareTestData(const size_t data_num)  //
     CreateDummyString(data_num, 0, data_vec, var_arr, count, base);
   } else if constexpr (std::is_same_v<T, uint64_t *>) {
     auto *ptr_arr = new uint64_t[data_num];
+    AdviseHugePages(ptr_arr, sizeof(uint64_t) * data_num);
     for (size_t i = 0; i < data_num; ++i) {
       ptr_arr[i] = i;
       data_vec.emplace_back(&(ptr_arr[i]));
@@ -223,12 +559,115 @@ void
 ReleaseTestData([[maybe_unused]] std::vector<T> &data_vec)
 {
   if constexpr (std::is_same_v<T, char *>) {
+    if (DatasetRegistry::Release(data_vec.front())) return;
     delete[] reinterpret_cast<VarData *>(data_vec.front());
   } else if constexpr (std::is_same_v<T, uint64_t *>) {
+    if (DatasetRegistry::Release(data_vec.front())) return;
     delete[] data_vec.front();
   }
 }
 
+/**
+ * @tparam T a class of test data.
+ * @return the path of a dataset file for the given class.
+ */
+template <class T>
+auto
+GetDatasetPath()  //
+    -> std::string
+{
+  std::string path{kDatasetDir};
+  if constexpr (std::is_same_v<T, char *>) {
+    path += "/var.dat";
+  } else if constexpr (std::is_same_v<T, uint64_t *>) {
+    path += "/ptr.dat";
+  } else {
+    path += "/" + std::string{typeid(T).name()} + ".dat";
+  }
+  return path;
+}
+
+/**
+ * @brief Load test data from a memory-mapped dataset file.
+ *
+ * If the dataset does not exist or has fewer records than required, this function
+ * creates test data and writes them as a dataset for the following runs. Variable-length
+ * data and pointers refer to records in the mapped file directly.
+ *
+ * @tparam T a class of test data.
+ * @param data_num the number of test data.
+ * @return test data.
+ */
+template <class T>
+auto
+LoadTestData(const size_t data_num)  //
+    -> std::vector<T>
+{
+  constexpr auto kIsVar = std::is_same_v<T, char *>;
+  constexpr auto kIsPtr = std::is_same_v<T, uint64_t *>;
+  constexpr size_t kRecSize = kIsVar ? 0 : (kIsPtr ? sizeof(uint64_t) : sizeof(T));
+
+  const auto &path = GetDatasetPath<T>();
+  auto dataset = MappedDataset::Open(path, kRecSize);
+  if (!dataset || dataset->GetRecordNum() < data_num) {
+    auto data_vec = CreateTestData<T>(data_num);
+    auto get_record = [&](const size_t i) -> std::pair<const void *, size_t> {
+      if constexpr (kIsVar) {
+        return {data_vec[i], GetLength(data_vec[i])};
+      } else if constexpr (kIsPtr) {
+        return {data_vec[i], kRecSize};
+      } else {
+        return {&(data_vec[i]), kRecSize};
+      }
+    };
+    if (!WriteDataset(path, data_num, kRecSize, get_record)) return data_vec;
+
+    dataset = MappedDataset::Open(path, kRecSize);
+    if (!dataset) return data_vec;
+    ReleaseTestData(data_vec);
+  }
+
+  std::vector<T> data_vec{};
+  data_vec.reserve(data_num);
+  for (size_t i = 0; i < data_num; ++i) {
+    auto *rec = const_cast<char *>(dataset->GetRecord(i));
+    if constexpr (kIsVar) {
+      data_vec.emplace_back(rec);
+    } else if constexpr (kIsPtr) {
+      data_vec.emplace_back(reinterpret_cast<uint64_t *>(rec));
+    } else {
+      data_vec.emplace_back(*reinterpret_cast<T *>(rec));
+    }
+  }
+
+  if constexpr (kIsVar || kIsPtr) {
+    if (!data_vec.empty()) DatasetRegistry::Retain(data_vec.front(), std::move(dataset));
+  }
+
+  return data_vec;
+}
+
+/**
+ * @brief Prepare test data.
+ *
+ * If `DBGROUP_TEST_DATASET_DIR` is set, test data are loaded from memory-mapped dataset
+ * files in the directory. Otherwise, test data are created in heap memory.
+ *
+ * @tparam T a class of test data.
+ * @param data_num the number of test data.
+ * @return test data.
+ */
+template <class T>
+auto
+PrepareTestData(const size_t data_num)  //
+    -> std::vector<T>
+{
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (!kDatasetDir.empty()) return LoadTestData<T>(data_num);
+  }
+  return CreateTestData<T>(data_num);
+}
+
 template <class T>
 constexpr auto
 IsVarLen()  //
@@ -241,6 +680,187 @@ IsVarLen()  //
   }
 }
 
+/*######################################################################################
+ * Utility classes for bulkloading
+ *####################################################################################*/
+
+/**
+ * @brief A forward range that lazily creates bulkload entries.
+ *
+ * Each entry is created from given sources when an iterator is dereferenced, so this
+ * range does not materialize all the entries in memory. The sources may refer to any
+ * storage of sorted keys and payloads (e.g., memory-mapped files). Since iterators
+ * return entries by value, they can be copied and dereferenced concurrently (e.g., to
+ * split bulkloading between threads), but a reference to a returned entry must not be
+ * kept.
+ *
+ * @tparam Key a class of keys.
+ * @tparam Payload a class of payloads.
+ * @tparam KeySource a function object to get the i-th key (`const Key &(size_t)`).
+ * @tparam PaySource a function object to get the i-th payload (`const Payload &(size_t)`).
+ */
+template <class Key, class Payload, class KeySource, class PaySource>
+class LazyEntryRange
+{
+ public:
+  /*####################################################################################
+   * Type aliases
+   *##################################################################################*/
+
+  using Entry = std::conditional_t<IsVarLen<Key>() || IsVarLen<Payload>(),
+                                   std::tuple<Key, Payload, size_t, size_t>,
+                                   std::pair<Key, Payload>>;
+
+  /*####################################################################################
+   * Iterator definition
+   *##################################################################################*/
+
+  class Iterator
+  {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Entry;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = Entry;
+
+    Iterator() = default;
+
+    Iterator(  //
+        const LazyEntryRange *range,
+        const size_t pos)
+        : range_{range}, pos_{pos}
+    {
+    }
+
+    auto
+    operator*() const  //
+        -> reference
+    {
+      const auto &key = range_->key_src_(pos_);
+      const auto &payload = range_->pay_src_(pos_);
+      if constexpr (IsVarLen<Key>() || IsVarLen<Payload>()) {
+        return Entry{key, payload, GetLength(key), GetLength(payload)};
+      } else {
+        return Entry{key, payload};
+      }
+    }
+
+    auto
+    operator++()  //
+        -> Iterator &
+    {
+      ++pos_;
+      return *this;
+    }
+
+    auto
+    operator++(int)  //
+        -> Iterator
+    {
+      auto prev = *this;
+      ++pos_;
+      return prev;
+    }
+
+    auto
+    operator==(const Iterator &rhs) const  //
+        -> bool
+    {
+      return pos_ == rhs.pos_;
+    }
+
+    auto
+    operator!=(const Iterator &rhs) const  //
+        -> bool
+    {
+      return pos_ != rhs.pos_;
+    }
+
+   private:
+    /// a range to be iterated.
+    const LazyEntryRange *range_{nullptr};
+
+    /// the current position.
+    size_t pos_{0};
+  };
+
+  /*####################################################################################
+   * Public constructors and assignment operators
+   *##################################################################################*/
+
+  /**
+   * @param size the number of entries.
+   * @param key_src a function object to get the i-th key.
+   * @param pay_src a function object to get the i-th payload.
+   */
+  LazyEntryRange(  //
+      const size_t size,
+      KeySource key_src,
+      PaySource pay_src)
+      : size_{size}, key_src_{std::move(key_src)}, pay_src_{std::move(pay_src)}
+  {
+  }
+
+  /*####################################################################################
+   * Public getters
+   *##################################################################################*/
+
+  [[nodiscard]] auto
+  begin() const  //
+      -> Iterator
+  {
+    return Iterator{this, 0};
+  }
+
+  [[nodiscard]] auto
+  end() const  //
+      -> Iterator
+  {
+    return Iterator{this, size_};
+  }
+
+  [[nodiscard]] auto
+  size() const  //
+      -> size_t
+  {
+    return size_;
+  }
+
+ private:
+  /*####################################################################################
+   * Internal member variables
+   *##################################################################################*/
+
+  /// the number of entries.
+  size_t size_{0};
+
+  /// a function object to get keys.
+  KeySource key_src_{};
+
+  /// a function object to get payloads.
+  PaySource pay_src_{};
+};
+
+/**
+ * @tparam Key a class of keys.
+ * @tparam Payload a class of payloads.
+ * @param size the number of entries.
+ * @param key_src a function object to get the i-th key.
+ * @param pay_src a function object to get the i-th payload.
+ * @return a range of lazily created bulkload entries.
+ */
+template <class Key, class Payload, class KeySource, class PaySource>
+auto
+MakeLazyEntryRange(  //
+    const size_t size,
+    KeySource key_src,
+    PaySource pay_src)
+{
+  return LazyEntryRange<Key, Payload, KeySource, PaySource>{size, std::move(key_src),
+                                                            std::move(pay_src)};
+}
+
 /*######################################################################################
  * Template functions for disbling tests of each operation
  *####################################################################################*/
@@ -253,6 +873,32 @@ HasScanOperation()  //
   return true;
 }
 
+/**
+ * @brief `ReverseScan` (i.e., a scan in descending order with the same arguments as
+ * `Scan`) is optional, so this operation is disabled by default.
+ *
+ */
+template <class ImplStat>
+constexpr auto
+HasReverseScanOperation()  //
+    -> bool
+{
+  return false;
+}
+
+/**
+ * @brief `Seek` of scan iterators (i.e., repositioning an iterator at a given begin key
+ * under its snapshot) is optional, so this operation is disabled by default.
+ *
+ */
+template <class ImplStat>
+constexpr auto
+HasIteratorSeekOperation()  //
+    -> bool
+{
+  return false;
+}
+
 template <class ImplStat>
 constexpr auto
 HasWriteOperation()  //
@@ -293,6 +939,45 @@ HasBulkloadOperation()  //
   return true;
 }
 
+/**
+ * @brief Bulkload from lazily created entries requires `Bulkload` to accept any forward
+ * range, so this operation is disabled by default.
+ *
+ */
+template <class ImplStat>
+constexpr auto
+HasStreamingBulkloadOperation()  //
+    -> bool
+{
+  return false;
+}
+
+/**
+ * @brief SMO counters require `GetSMOCounts()` to return a pair of the numbers of leaf and
+ * internal SMOs performed so far, so this option is disabled by default.
+ *
+ */
+template <class ImplStat>
+constexpr auto
+HasSMOCounters()  //
+    -> bool
+{
+  return false;
+}
+
+/**
+ * @brief Prefetching requires `Prefetch(key, key_len)` to issue prefetches for the nodes
+ * on the path to a key without waiting for them, so this operation is disabled by default.
+ *
+ */
+template <class ImplStat>
+constexpr auto
+HasPrefetchOperation()  //
+    -> bool
+{
+  return false;
+}
+
 /*######################################################################################
  * Type definitions for templated tests
  *####################################################################################*/
@@ -350,6 +1035,27 @@ struct Original {
   using Comp = std::less<MyClass>;
 };
 
+template <size_t kSize>
+struct Fixed {
+  using Data = FixedPayload<kSize>;
+  using Comp = std::less<FixedPayload<kSize>>;
+};
+
+using Fixed16 = Fixed<16>;      // NOLINT
+using Fixed64 = Fixed<64>;      // NOLINT
+using Fixed256 = Fixed<256>;    // NOLINT
+using Fixed1024 = Fixed<1024>;  // NOLINT
+
+template <size_t kSize>
+struct Bin {
+  using Data = BinaryKey<kSize>;
+  using Comp = std::less<BinaryKey<kSize>>;
+};
+
+using Bin16 = Bin<16>;  // NOLINT
+using Bin32 = Bin<32>;  // NOLINT
+using Bin64 = Bin<64>;  // NOLINT
+
 }  // namespace dbgroup::index::test
 
 #endif  // INDEX_FIXTURES_COMMON_HPP
@@ -0,0 +1,205 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_FIXTURES_COMPARISON_HPP
+#define INDEX_FIXTURES_COMPARISON_HPP
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+// system libraries
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace dbgroup::index::test
+{
+/*######################################################################################
+ * Utility functions for comparison
+ *####################################################################################*/
+
+/**
+ * @tparam T a target class.
+ * @return the readable name of the class without the namespaces of the outermost one.
+ */
+template <class T>
+auto
+GetTypeName()  //
+    -> std::string
+{
+  std::string name{typeid(T).name()};
+#if defined(__GNUG__)
+  int status = 0;
+  std::unique_ptr<char, decltype(&std::free)> demangled{
+      abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status), &std::free};
+  if (status == 0) {
+    name = demangled.get();
+  }
+#endif
+
+  const auto args_pos = name.find('<');
+  const auto ns_pos = name.rfind("::", args_pos);
+  return (ns_pos == std::string::npos) ? name : name.substr(ns_pos + 2);
+}
+
+/*######################################################################################
+ * Classes for comparison
+ *####################################################################################*/
+
+/**
+ * @brief A table to compare the throughput of indexes across typed tests.
+ *
+ * Benchmarks record their results for each group of the same workload and data types,
+ * and the table is output at the exit of a process. In each group, the index recorded
+ * first (i.e., the first one in a list of typed tests) is regarded as the baseline of
+ * speedups.
+ */
+class ComparisonTable
+{
+ public:
+  /*####################################################################################
+   * Public constructors and assignment operators
+   *##################################################################################*/
+
+  ComparisonTable(const ComparisonTable &) = delete;
+  ComparisonTable(ComparisonTable &&) = delete;
+
+  auto operator=(const ComparisonTable &) -> ComparisonTable & = delete;
+  auto operator=(ComparisonTable &&) -> ComparisonTable & = delete;
+
+  /*####################################################################################
+   * Public destructors
+   *##################################################################################*/
+
+  ~ComparisonTable() { Report(std::cout); }
+
+  /*####################################################################################
+   * Public utility functions
+   *##################################################################################*/
+
+  /**
+   * @param group the name of a group (i.e., a workload with data types).
+   * @param index the name of an index.
+   * @param ops_per_sec the throughput of the index.
+   */
+  static void
+  Record(  //
+      const std::string_view group,
+      const std::string_view index,
+      const double ops_per_sec)
+  {
+    auto &table = GetInstance();
+    const std::lock_guard guard{table.mtx_};
+    table.rows_.push_back({std::string{group}, std::string{index}, ops_per_sec});
+  }
+
+ private:
+  /*####################################################################################
+   * Internal classes
+   *##################################################################################*/
+
+  /**
+   * @brief A recorded result.
+   *
+   */
+  struct Row {
+    /// the name of a group.
+    std::string group{};
+
+    /// the name of an index.
+    std::string index{};
+
+    /// the throughput of the index.
+    double ops_per_sec{0};
+  };
+
+  /*####################################################################################
+   * Internal constructors
+   *##################################################################################*/
+
+  ComparisonTable() = default;
+
+  /*####################################################################################
+   * Internal utility functions
+   *##################################################################################*/
+
+  static auto
+  GetInstance()  //
+      -> ComparisonTable &
+  {
+    static ComparisonTable table{};
+    return table;
+  }
+
+  /**
+   * @brief Output recorded results grouped in the recorded order.
+   *
+   * @param out an output stream.
+   */
+  void
+  Report(std::ostream &out) const
+  {
+    constexpr int kValueWidth = 14;
+    constexpr int kSpeedupWidth = 9;
+
+    std::vector<bool> printed(rows_.size(), false);
+    for (size_t i = 0; i < rows_.size(); ++i) {
+      if (printed[i]) continue;
+
+      const auto &baseline = rows_[i];
+      out << "[ COMPARE  ] " << baseline.group << "\n"                      //
+          << "[ COMPARE  ] " << std::setw(kValueWidth) << "ops_per_sec"     //
+          << std::setw(kSpeedupWidth) << "speedup" << "  index" << "\n";
+      for (size_t j = i; j < rows_.size(); ++j) {
+        const auto &row = rows_[j];
+        if (row.group != baseline.group) continue;
+
+        printed[j] = true;
+        const auto speedup = row.ops_per_sec / baseline.ops_per_sec;
+        out << "[ COMPARE  ] " << std::fixed << std::setprecision(1)         //
+            << std::setw(kValueWidth) << row.ops_per_sec                      //
+            << std::setprecision(2) << std::setw(kSpeedupWidth) << speedup   //
+            << "  " << row.index << "\n";
+        out.unsetf(std::ios::fixed);
+      }
+    }
+    out << std::flush;
+  }
+
+  /*####################################################################################
+   * Internal member variables
+   *##################################################################################*/
+
+  /// a mutex for concurrent recording.
+  std::mutex mtx_{};
+
+  /// recorded results.
+  std::vector<Row> rows_{};
+};
+
+}  // namespace dbgroup::index::test
+
+#endif  // INDEX_FIXTURES_COMPARISON_HPP
@@ -0,0 +1,365 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_FIXTURES_DATASET_HPP
+#define INDEX_FIXTURES_DATASET_HPP
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+// system libraries
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace dbgroup::index::test
+{
+/*######################################################################################
+ * Constants for datasets
+ *####################################################################################*/
+
+/// the magic number of dataset files ("DBGRDATA" in little endian).
+constexpr uint64_t kDatasetMagic = 0x4154414452474244;
+
+/// the version of the dataset format.
+constexpr uint64_t kDatasetVersion = 1;
+
+/*######################################################################################
+ * Classes for datasets
+ *####################################################################################*/
+
+/**
+ * @brief The header of a dataset file.
+ *
+ * A dataset file is a column of records and consists of this header, `record_num + 1`
+ * offsets of records (only if records have variable length), and record bytes. All the
+ * values are written in the native byte order. Records must be sorted in ascending order
+ * if they are used as keys.
+ */
+struct DatasetHeader {
+  /// the magic number for validation.
+  uint64_t magic{kDatasetMagic};
+
+  /// the version of the format.
+  uint64_t version{kDatasetVersion};
+
+  /// the number of records.
+  uint64_t record_num{0};
+
+  /// the size of each record (zero means variable length).
+  uint64_t record_size{0};
+};
+
+/**
+ * @brief A read-only view of a memory-mapped dataset file.
+ *
+ * Records are loaded lazily by the OS, so opening a dataset does not depend on its size.
+ */
+class MappedDataset
+{
+ public:
+  /*####################################################################################
+   * Public constructors and assignment operators
+   *##################################################################################*/
+
+  MappedDataset(const MappedDataset &) = delete;
+  MappedDataset(MappedDataset &&) = delete;
+
+  auto operator=(const MappedDataset &) -> MappedDataset & = delete;
+  auto operator=(MappedDataset &&) -> MappedDataset & = delete;
+
+  /*####################################################################################
+   * Public destructors
+   *##################################################################################*/
+
+  ~MappedDataset() { munmap(addr_, map_size_); }
+
+  /*####################################################################################
+   * Public builders
+   *##################################################################################*/
+
+  /**
+   * @param path the path of a dataset file.
+   * @param record_size the expected size of each record (zero means variable length).
+   * @return a mapped dataset if a valid file exists, `nullptr` otherwise.
+   */
+  [[nodiscard]] static auto
+  Open(  //
+      const std::string &path,
+      const size_t record_size)  //
+      -> std::unique_ptr<MappedDataset>
+  {
+    const auto fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return nullptr;
+
+    struct stat st {
+    };
+    const auto size = (fstat(fd, &st) == 0) ? static_cast<size_t>(st.st_size) : 0;
+    auto *addr = (size < sizeof(DatasetHeader))
+                     ? MAP_FAILED
+                     : mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) return nullptr;
+
+    std::unique_ptr<MappedDataset> dataset{new MappedDataset{addr, size}};
+    if (!dataset->IsValid(record_size)) return nullptr;
+
+    return dataset;
+  }
+
+  /*####################################################################################
+   * Public getters
+   *##################################################################################*/
+
+  /**
+   * @return the number of records.
+   */
+  [[nodiscard]] auto
+  GetRecordNum() const  //
+      -> size_t
+  {
+    return header_->record_num;
+  }
+
+  /**
+   * @param pos the position of a record.
+   * @return the address of the record.
+   */
+  [[nodiscard]] auto
+  GetRecord(const size_t pos) const  //
+      -> const char *
+  {
+    const auto *data = reinterpret_cast<const char *>(addr_) + GetDataOffset();
+    if (header_->record_size == 0) return data + GetOffsets()[pos];
+    return data + header_->record_size * pos;
+  }
+
+ private:
+  /*####################################################################################
+   * Internal constructors
+   *##################################################################################*/
+
+  MappedDataset(  //
+      void *addr,
+      const size_t map_size)
+      : addr_{addr}, map_size_{map_size}, header_{reinterpret_cast<DatasetHeader *>(addr)}
+  {
+  }
+
+  /*####################################################################################
+   * Internal getters
+   *##################################################################################*/
+
+  [[nodiscard]] auto
+  GetOffsets() const  //
+      -> const uint64_t *
+  {
+    return reinterpret_cast<const uint64_t *>(header_ + 1);
+  }
+
+  [[nodiscard]] auto
+  GetDataOffset() const  //
+      -> size_t
+  {
+    const auto offset_num = (header_->record_size == 0) ? header_->record_num + 1 : 0;
+    return sizeof(DatasetHeader) + sizeof(uint64_t) * offset_num;
+  }
+
+  /**
+   * @param record_size the expected size of each record.
+   * @retval true if the header matches and all the records lie within the file.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto
+  IsValid(const size_t record_size) const  //
+      -> bool
+  {
+    if (header_->magic != kDatasetMagic || header_->version != kDatasetVersion
+        || header_->record_size != record_size) {
+      return false;
+    }
+
+    // check the number of records before computing sizes to avoid overflow
+    const auto body_size = map_size_ - sizeof(DatasetHeader);
+    const auto rec_num = header_->record_num;
+    if (record_size > 0) return rec_num <= body_size / record_size;
+    if (rec_num >= body_size / sizeof(uint64_t)) return false;
+
+    // variable-length records are valid only if their offsets are monotonic
+    const auto *offsets = GetOffsets();
+    for (size_t i = 0; i < rec_num; ++i) {
+      if (offsets[i] > offsets[i + 1]) return false;
+    }
+    return offsets[rec_num] <= map_size_ - GetDataOffset();
+  }
+
+  /*####################################################################################
+   * Internal member variables
+   *##################################################################################*/
+
+  /// the address of a mapped file.
+  void *addr_{nullptr};
+
+  /// the size of a mapped file.
+  size_t map_size_{0};
+
+  /// the header of a mapped file.
+  const DatasetHeader *header_{nullptr};
+};
+
+/**
+ * @brief A registry of datasets referred by test data.
+ *
+ * Test data refer to records in mapped datasets directly, so each dataset is kept mapped
+ * until the corresponding test data are released.
+ */
+class DatasetRegistry
+{
+ public:
+  /*####################################################################################
+   * Public utility functions
+   *##################################################################################*/
+
+  /**
+   * @param data the address of the first record of test data.
+   * @param dataset a mapped dataset referred by the test data.
+   */
+  static void
+  Retain(  //
+      const void *data,
+      std::unique_ptr<MappedDataset> dataset)
+  {
+    auto &registry = GetInstance();
+    const std::lock_guard guard{registry.mtx_};
+    registry.datasets_[data] = std::move(dataset);
+  }
+
+  /**
+   * @param data the address of the first record of test data.
+   * @retval true if the corresponding dataset is unmapped.
+   * @retval false if the test data do not refer to any dataset.
+   */
+  static auto
+  Release(const void *data)  //
+      -> bool
+  {
+    auto &registry = GetInstance();
+    const std::lock_guard guard{registry.mtx_};
+    return registry.datasets_.erase(data) > 0;
+  }
+
+ private:
+  /*####################################################################################
+   * Internal utility functions
+   *##################################################################################*/
+
+  static auto
+  GetInstance()  //
+      -> DatasetRegistry &
+  {
+    static DatasetRegistry registry{};
+    return registry;
+  }
+
+  /*####################################################################################
+   * Internal member variables
+   *##################################################################################*/
+
+  /// a mutex for concurrent fixtures.
+  std::mutex mtx_{};
+
+  /// mapped datasets with the addresses of their first records.
+  std::map<const void *, std::unique_ptr<MappedDataset>> datasets_{};
+};
+
+/*######################################################################################
+ * Utility functions for datasets
+ *####################################################################################*/
+
+/**
+ * @brief Write records to a dataset file.
+ *
+ * The file is written to a unique temporary path and renamed, so other processes never
+ * map a partially written dataset even if they write the same one concurrently.
+ *
+ * @tparam GetRecord a function object with the signature `std::pair<const void *,
+ * size_t>(size_t)` to get the address and length of each record.
+ * @param path the path of a dataset file.
+ * @param record_num the number of records.
+ * @param record_size the size of each record (zero means variable length).
+ * @param get_record a function object to get records.
+ * @retval true if the dataset is written.
+ * @retval false otherwise.
+ */
+template <class GetRecord>
+auto
+WriteDataset(  //
+    const std::string &path,
+    const size_t record_num,
+    const size_t record_size,
+    GetRecord &&get_record)  //
+    -> bool
+{
+  std::string tmp_path = path + ".XXXXXX";
+  const auto fd = mkstemp(tmp_path.data());
+  if (fd < 0) return false;
+  const auto mode_set = fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH) == 0;
+  close(fd);
+
+  auto written = mode_set;
+  if (written) {
+    std::ofstream out{tmp_path, std::ios::binary | std::ios::trunc};
+    auto write = [&](const void *data, const size_t len) {
+      return written && out.write(reinterpret_cast<const char *>(data),  //
+                                  static_cast<std::streamsize>(len));
+    };
+
+    const DatasetHeader header{kDatasetMagic, kDatasetVersion, record_num, record_size};
+    written = write(&header, sizeof(DatasetHeader));
+    if (record_size == 0) {
+      uint64_t offset = 0;
+      for (size_t i = 0; i <= record_num && written; ++i) {
+        written = write(&offset, sizeof(uint64_t));
+        if (i < record_num) offset += get_record(i).second;
+      }
+    }
+    for (size_t i = 0; i < record_num && written; ++i) {
+      const auto &[rec, len] = get_record(i);
+      written = write(rec, len);
+    }
+    written = written && out.flush();
+  }
+
+  if (!written || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace dbgroup::index::test
+
+#endif  // INDEX_FIXTURES_DATASET_HPP
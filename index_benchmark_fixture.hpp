@@ -0,0 +1,1499 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_FIXTURES_INDEX_BENCHMARK_FIXTURE_HPP
+#define INDEX_FIXTURES_INDEX_BENCHMARK_FIXTURE_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// external sources
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+#include "comparison.hpp"
+#include "metrics.hpp"
+
+namespace dbgroup::index::test
+{
+/*######################################################################################
+ * Fixture class definition
+ *####################################################################################*/
+
+template <class IndexInfo>
+class IndexBenchmarkFixture : public testing::Test
+{
+  /*####################################################################################
+   * Type aliases
+   *##################################################################################*/
+
+  // extract key-payload types
+  using Key = typename IndexInfo::Key::Data;
+  using Payload = typename IndexInfo::Payload::Data;
+  using KeyComp = typename IndexInfo::Key::Comp;
+  using PayComp = typename IndexInfo::Payload::Comp;
+  using Index_t = typename IndexInfo::Index_t;
+  using ImplStat = typename IndexInfo::ImplStatus;
+  using ScanKey = std::optional<std::tuple<const Key &, size_t, bool>>;
+  using Clock = std::chrono::steady_clock;
+  using Nano = std::chrono::nanoseconds;
+
+  using EpochManager = ::dbgroup::memory::EpochManager;
+
+ protected:
+  /*####################################################################################
+   * Internal constants
+   *##################################################################################*/
+
+  static constexpr size_t kThreadNum = DBGROUP_TEST_THREAD_NUM;
+  static constexpr size_t kMinKeyNum = 1E5;
+  static constexpr size_t kMinFootprintKeyNum = 1E2;
+  static constexpr size_t kUpdateRoundNum = 10;
+  static constexpr size_t kCompareScanLength = 100;
+  static constexpr size_t kMaxGroupSize = 32;
+  static constexpr size_t kRecentKeyNum = 1E3;
+  static constexpr size_t kMaxKeyNum = DBGROUP_TEST_BENCH_MAX_KEY_NUM;
+  static constexpr size_t kEpochIntervalMicro = 1000;
+  static constexpr double kMebi = 1024.0 * 1024.0;
+
+  /*####################################################################################
+   * Setup/Teardown
+   *##################################################################################*/
+
+  void
+  SetUp() override
+  {
+    epoch_manager_ = std::make_shared<EpochManager>();
+  }
+
+  void
+  TearDown() override
+  {
+    index_ = nullptr;
+  }
+
+  /*####################################################################################
+   * Utility functions
+   *##################################################################################*/
+
+  void
+  PrepareData(const size_t key_num)
+  {
+    keys_ = PrepareTestData<Key>(key_num);
+    payloads_ = PrepareTestData<Payload>(key_num);
+  }
+
+  void
+  DestroyData()
+  {
+    ReleaseTestData(keys_);
+    ReleaseTestData(payloads_);
+    keys_.clear();
+    payloads_.clear();
+  }
+
+  void
+  CreateIndex()
+  {
+    index_ = nullptr;  // release the previous index before measuring memory usage
+    index_ = std::make_unique<Index_t>(epoch_manager_, kEpochIntervalMicro);
+  }
+
+  [[nodiscard]] auto
+  GetScanKey(  //
+      const size_t id,
+      const bool closed) const  //
+      -> ScanKey
+  {
+    const auto &key = keys_.at(id);
+    return std::make_tuple(std::cref(key), GetLength(key), closed);
+  }
+
+  [[nodiscard]] static auto
+  GetPartition(  //
+      const size_t key_num,
+      const size_t thread_num,
+      const size_t w_id)  //
+      -> std::pair<size_t, size_t>
+  {
+    const auto part_num = key_num / thread_num;
+    const auto begin = part_num * w_id;
+    const auto end = (w_id == thread_num - 1) ? key_num : begin + part_num;
+    return {begin, end};
+  }
+
+  /**
+   * @return the numbers of threads for scalability sweeps (powers of two and then
+   * `kThreadNum` if it is not a power of two).
+   */
+  [[nodiscard]] static auto
+  GetThreadNums()  //
+      -> std::vector<size_t>
+  {
+    std::vector<size_t> thread_nums{};
+    for (size_t thread_num = 1; thread_num < kThreadNum; thread_num *= 2) {
+      thread_nums.emplace_back(thread_num);
+    }
+    thread_nums.emplace_back(kThreadNum);
+    return thread_nums;
+  }
+
+  /**
+   * @brief Run a given function with multiple threads and measure its execution time.
+   *
+   * @param thread_num the number of worker threads.
+   * @param func a function to be executed by each worker.
+   * @return the execution time in seconds.
+   */
+  static auto
+  RunParallel(  //
+      const size_t thread_num,
+      const std::function<void(size_t)> &func)  //
+      -> double
+  {
+    std::promise<void> start_signal{};
+    const auto &start_future = start_signal.get_future().share();
+
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < thread_num; ++i) {
+      threads.emplace_back([&, i] {
+        start_future.wait();
+        func(i);
+      });
+    }
+
+    const auto start = Clock::now();
+    start_signal.set_value();
+    for (auto &&t : threads) {
+      t.join();
+    }
+    const std::chrono::duration<double> exec_time = Clock::now() - start;
+
+    return exec_time.count();
+  }
+
+  auto
+  Write(  //
+      [[maybe_unused]] const size_t key_id,
+      [[maybe_unused]] const size_t pay_id)
+  {
+    if constexpr (HasWriteOperation<ImplStat>()) {
+      const auto &key = keys_.at(key_id);
+      const auto &payload = payloads_.at(pay_id);
+      return index_->Write(key, payload, GetLength(key), GetLength(payload));
+    } else {
+      return 0;
+    }
+  }
+
+  auto
+  Update(  //
+      [[maybe_unused]] const size_t key_id,
+      [[maybe_unused]] const size_t pay_id)
+  {
+    if constexpr (HasUpdateOperation<ImplStat>()) {
+      const auto &key = keys_.at(key_id);
+      const auto &payload = payloads_.at(pay_id);
+      return index_->Update(key, payload, GetLength(key), GetLength(payload));
+    } else {
+      return 0;
+    }
+  }
+
+  /**
+   * @param key_num the number of entries to be bulkloaded.
+   * @return materialized entries of the first `key_num` keys for bulkloading.
+   */
+  auto
+  CreateEntries(const size_t key_num)
+  {
+    if constexpr (IsVarLen<Key>() || IsVarLen<Payload>()) {
+      std::vector<std::tuple<Key, Payload, size_t, size_t>> entries{};
+      entries.reserve(key_num);
+      for (size_t i = 0; i < key_num; ++i) {
+        const auto &key = keys_.at(i);
+        const auto &payload = payloads_.at(i);
+        entries.emplace_back(key, payload, GetLength(key), GetLength(payload));
+      }
+      return entries;
+    } else {
+      std::vector<std::pair<Key, Payload>> entries{};
+      entries.reserve(key_num);
+      for (size_t i = 0; i < key_num; ++i) {
+        entries.emplace_back(keys_.at(i), payloads_.at(i));
+      }
+      return entries;
+    }
+  }
+
+  /**
+   * @param key_num the number of entries to be bulkloaded.
+   * @param thread_num the number of threads for bulkloading.
+   * @param streaming a flag for creating entries lazily instead of materializing them.
+   * @return the return code of bulkloading.
+   */
+  auto
+  Bulkload(  //
+      [[maybe_unused]] const size_t key_num,
+      [[maybe_unused]] const size_t thread_num,
+      [[maybe_unused]] const bool streaming = false)
+  {
+    if constexpr (HasStreamingBulkloadOperation<ImplStat>()) {
+      if (streaming) {
+        const auto &entries = MakeLazyEntryRange<Key, Payload>(
+            key_num,  //
+            [&](const size_t i) -> const Key & { return keys_[i]; },
+            [&](const size_t i) -> const Payload & { return payloads_[i]; });
+        return index_->Bulkload(entries, thread_num);
+      }
+    }
+
+    if constexpr (!HasBulkloadOperation<ImplStat>()) {
+      return 0;
+    } else {
+      return index_->Bulkload(CreateEntries(key_num), thread_num);
+    }
+  }
+
+  /**
+   * @brief Fill an index with the first `key_num` keys by bulkloading if possible.
+   *
+   * @param key_num the number of keys to be inserted.
+   */
+  void
+  FillIndex(const size_t key_num)
+  {
+    if constexpr (HasBulkloadOperation<ImplStat>()) {
+      ASSERT_EQ(Bulkload(key_num, kThreadNum), 0);
+    } else {
+      auto mt_worker = [&](const size_t w_id) -> void {
+        const auto [begin, end] = GetPartition(key_num, kThreadNum, w_id);
+        for (size_t i = begin; i < end; ++i) {
+          EXPECT_EQ(Write(i, i), 0);
+        }
+      };
+      RunParallel(kThreadNum, mt_worker);
+    }
+  }
+
+  /**
+   * @brief Measure the throughput of random lookups with all the threads.
+   *
+   * @param key_num the number of keys in an index.
+   * @return the throughput in operations per second.
+   */
+  auto
+  MeasureReads(const size_t key_num)  //
+      -> double
+  {
+    auto mt_worker = [&](const size_t w_id) -> void {
+      std::mt19937_64 rng{kRandomSeed + w_id};
+      std::uniform_int_distribution<size_t> id_dist{0, key_num - 1};
+      for (size_t i = 0; i < kExecNum; ++i) {
+        const auto &key = keys_.at(id_dist(rng));
+        const auto &read_val = index_->Read(key, GetLength(key));
+        EXPECT_TRUE(read_val);
+      }
+    };
+
+    const auto exec_time = RunParallel(kThreadNum, mt_worker);
+    return kExecNum * kThreadNum / exec_time;
+  }
+
+  /**
+   * @param payload a payload created by `PrepareData`.
+   * @return the ID of the payload.
+   */
+  [[nodiscard]] static auto
+  GetPayloadID(const Payload &payload)  //
+      -> size_t
+  {
+    if constexpr (std::is_same_v<Payload, uint64_t *>) {
+      return *payload;
+    } else {
+      return static_cast<size_t>(payload);
+    }
+  }
+
+  /**
+   * @return the numbers of leaf and internal SMOs (zeros if an index has no counters).
+   */
+  [[nodiscard]] auto
+  GetSMOCounts() const  //
+      -> std::pair<size_t, size_t>
+  {
+    if constexpr (HasSMOCounters<ImplStat>()) {
+      return index_->GetSMOCounts();
+    } else {
+      return {0, 0};
+    }
+  }
+
+  /*####################################################################################
+   * Functions for benchmarks
+   *##################################################################################*/
+
+  void
+  MeasureBulkloadScaling()
+  {
+    if (!HasBulkloadOperation<ImplStat>() || !HasWriteOperation<ImplStat>()) {
+      GTEST_SKIP();
+    }
+
+    for (size_t key_num = kMinKeyNum; key_num <= kMaxKeyNum; key_num *= 10) {  // NOLINT
+      PrepareData(key_num);
+
+      // materialize the input in advance to measure only bulkloading
+      const auto &entries = CreateEntries(key_num);
+      for (const auto thread_num : GetThreadNums()) {
+        if constexpr (HasBulkloadOperation<ImplStat>()) {
+          CreateIndex();
+          const int64_t base_mem = GetMemoryUsage();
+
+          const auto start = Clock::now();
+          const auto rc = index_->Bulkload(entries, thread_num);
+          const std::chrono::duration<double> load_time = Clock::now() - start;
+          ASSERT_EQ(rc, 0);
+
+          const auto mem = static_cast<int64_t>(GetMemoryUsage()) - base_mem;
+          const auto read_tput = MeasureReads(key_num);
+          std::cout << "[ BULKLOAD ] keys=" << key_num                   //
+                    << ", threads=" << thread_num                        //
+                    << ", load_sec=" << load_time.count()                //
+                    << ", keys_per_sec=" << key_num / load_time.count()  //
+                    << ", memory_mib=" << mem / kMebi                    //
+                    << ", read_ops_per_sec=" << read_tput << std::endl;
+        }
+      }
+
+      // compare lookups with an index constructed by incremental writes
+      CreateIndex();
+      const int64_t base_mem = GetMemoryUsage();
+      auto mt_worker = [&](const size_t w_id) -> void {
+        const auto [begin, end] = GetPartition(key_num, kThreadNum, w_id);
+        for (size_t i = begin; i < end; ++i) {
+          EXPECT_EQ(Write(i, i), 0);
+        }
+      };
+      const auto load_time = RunParallel(kThreadNum, mt_worker);
+
+      const auto mem = static_cast<int64_t>(GetMemoryUsage()) - base_mem;
+      const auto read_tput = MeasureReads(key_num);
+      std::cout << "[  WRITES  ] keys=" << key_num                       //
+                << ", threads=" << kThreadNum                             //
+                << ", load_sec=" << load_time                             //
+                << ", keys_per_sec=" << key_num / load_time               //
+                << ", memory_mib=" << mem / kMebi                         //
+                << ", read_ops_per_sec=" << read_tput << std::endl;
+
+      index_ = nullptr;
+      DestroyData();
+    }
+  }
+
+  /**
+   * @brief Compare bulkloading from materialized entries with one from lazily created
+   * entries in terms of throughput and peak memory usage.
+   *
+   */
+  void
+  MeasureStreamingBulkload()
+  {
+    if (!HasBulkloadOperation<ImplStat>()) {
+      GTEST_SKIP();
+    }
+
+    for (size_t key_num = kMinKeyNum; key_num <= kMaxKeyNum; key_num *= 10) {  // NOLINT
+      PrepareData(key_num);
+
+      for (const auto streaming : {false, true}) {
+        if (streaming && !HasStreamingBulkloadOperation<ImplStat>()) continue;
+
+        CreateIndex();
+        const auto has_peak = ResetPeakResidentMemory();
+        const int64_t base_mem = GetResidentMemory();
+
+        const auto start = Clock::now();
+        const auto rc = Bulkload(key_num, kThreadNum, streaming);
+        const std::chrono::duration<double> load_time = Clock::now() - start;
+        ASSERT_EQ(rc, 0);
+
+        const int64_t peak_mem = GetPeakResidentMemory();
+        const auto peak = has_peak ? (peak_mem - base_mem) / kMebi : std::nan("");
+        std::cout << "[ BULKLOAD ] input=" << (streaming ? "streaming" : "materialized")  //
+                  << ", keys=" << key_num                                                 //
+                  << ", threads=" << kThreadNum                                           //
+                  << ", load_sec=" << load_time.count()                                   //
+                  << ", keys_per_sec=" << key_num / load_time.count()                     //
+                  << ", peak_mib=" << peak << std::endl;
+      }
+
+      index_ = nullptr;
+      DestroyData();
+    }
+  }
+
+  /**
+   * @brief Measure bytes per key of an index constructed by writes or bulkloading.
+   *
+   * The footprint of the written index is also measured after one and ten rounds of
+   * updates. Each round runs in a new epoch while the snapshots before all the rounds are
+   * kept protected, so an index must retain every old version of records. RSS deltas are
+   * reported only for `kMinKeyNum` keys or more because an allocator reuses pages freed
+   * by previous indexes and smaller deltas are hidden by them.
+   */
+  void
+  MeasureMemoryFootprint()
+  {
+    if (!HasWriteOperation<ImplStat>()) {
+      GTEST_SKIP();
+    }
+
+    for (size_t key_num = kMinFootprintKeyNum; key_num <= kMaxKeyNum; key_num *= 10) {  // NOLINT
+      PrepareData(key_num);
+
+      int64_t base_mem = 0;
+      int64_t base_rss = 0;
+      auto reset_base = [&]() -> void {
+        CreateIndex();
+        base_mem = GetMemoryUsage();
+        base_rss = GetResidentMemory();
+      };
+      auto report = [&](const char *phase) -> void {
+        const auto mem = static_cast<int64_t>(GetMemoryUsage()) - base_mem;
+        const auto rss = static_cast<int64_t>(GetResidentMemory()) - base_rss;
+        const auto rss_per_key =
+            (key_num >= kMinKeyNum) ? static_cast<double>(rss) / key_num : std::nan("");
+        std::cout << "[  MEMORY  ] keys=" << key_num                             //
+                  << ", phase=" << phase                                       //
+                  << ", bytes_per_key=" << static_cast<double>(mem) / key_num  //
+                  << ", rss_bytes_per_key=" << rss_per_key                     //
+                  << std::endl;
+      };
+      auto write_all = [&](const size_t round) -> void {
+        auto mt_worker = [&](const size_t w_id) -> void {
+          const auto [begin, end] = GetPartition(key_num, kThreadNum, w_id);
+          for (size_t i = begin; i < end; ++i) {
+            EXPECT_EQ(Write(i, (i + round) % key_num), 0);
+          }
+        };
+        RunParallel(kThreadNum, mt_worker);
+      };
+
+      // each round keeps a snapshot protected until all the rounds finish
+      std::function<void(size_t)> update_from = [&](const size_t round) -> void {
+        if (round > kUpdateRoundNum) {
+          report("updates_10");
+          return;
+        }
+        epoch_manager_->ForwardGlobalEpoch();
+        const auto &snapshot = epoch_manager_->GetProtectedEpochs();
+        write_all(round);
+        if (round == 1) report("updates_1");
+        update_from(round + 1);
+      };
+
+      reset_base();
+      write_all(0);
+      report("fill");
+      update_from(1);
+
+      if constexpr (HasBulkloadOperation<ImplStat>()) {
+        reset_base();
+        ASSERT_EQ(Bulkload(key_num, kThreadNum), 0);
+        report("bulkload");
+      }
+
+      index_ = nullptr;
+      DestroyData();
+    }
+  }
+
+  /**
+   * @brief Measure append-only ingestion of strictly increasing keys.
+   *
+   * Writers take key IDs from a shared counter as auto-increment IDs or timestamps, so
+   * all of them contend on the rightmost leaf. At the same time, readers perform
+   * `SnapshotRead` on the latest `kRecentKeyNum` keys that are visible in their
+   * snapshots. A controller thread forwards the global epoch and publishes the watermark
+   * below which every key has been written.
+   */
+  void
+  MeasureMonotonicIngest()
+  {
+    if (!HasWriteOperation<ImplStat>()) {
+      GTEST_SKIP();
+    }
+
+    constexpr size_t kKeyNum = kMaxKeyNum;
+    constexpr size_t kIdle = std::numeric_limits<size_t>::max();
+    constexpr size_t kReaderNum = kThreadNum / 2;
+    constexpr size_t kWriterNum = kThreadNum - kReaderNum;
+    PrepareData(kKeyNum);
+    CreateIndex();
+
+    std::atomic_size_t next_id{0};
+    std::atomic_size_t visible_num{0};
+    std::atomic_size_t running_num{kWriterNum};
+    std::atomic_size_t read_num{0};
+
+    // pad claimed IDs to avoid false sharing between writers
+    struct alignas(kCacheLineSize) ClaimedID {
+      std::atomic_size_t id{};
+    };
+    std::vector<ClaimedID> in_flight(kWriterNum);
+    for (auto &claimed : in_flight) {
+      claimed.id.store(kIdle);
+    }
+
+    // publish the number of contiguously written keys after forwarding an epoch
+    auto forwarder = [&]() -> void {
+      while (running_num.load() > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds{kEpochIntervalMicro});
+        auto watermark = next_id.load();
+        for (const auto &claimed : in_flight) {
+          watermark = std::min(watermark, claimed.id.load());
+        }
+        epoch_manager_->ForwardGlobalEpoch();
+        visible_num.store(std::min(watermark, kKeyNum));
+      }
+    };
+
+    std::once_flag start_flag{};
+    Clock::time_point start{};
+    double write_time = 0;
+    auto mt_worker = [&](const size_t w_id) -> void {
+      std::call_once(start_flag, [&] { start = Clock::now(); });  // shared by all workers
+      if (w_id < kWriterNum) {
+        auto &claimed = in_flight[w_id].id;
+        while (true) {
+          claimed.store(next_id.load());  // a lower bound of the next claim
+          const auto id = next_id.fetch_add(1);
+          if (id >= kKeyNum) break;
+          claimed.store(id);
+          EXPECT_EQ(Write(id, id), 0);
+        }
+        claimed.store(kIdle);
+        if (running_num.fetch_sub(1) == 1) {
+          write_time = std::chrono::duration<double>{Clock::now() - start}.count();
+        }
+        return;
+      }
+
+      std::mt19937_64 rng{kRandomSeed + w_id};
+      size_t count = 0;
+      while (running_num.load() > 0) {
+        const auto num = visible_num.load();  // load before protecting a snapshot
+        if (num == 0) {
+          std::this_thread::yield();
+          continue;
+        }
+        std::uniform_int_distribution<size_t> id_dist{num - std::min(num, kRecentKeyNum),
+                                                      num - 1};
+        const auto &key = keys_[id_dist(rng)];
+        const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+        const auto &read_val =
+            index_->SnapshotRead(key, epoch_guard, protected_epochs, GetLength(key));
+        EXPECT_TRUE(read_val);
+        ++count;
+      }
+      read_num.fetch_add(count);
+    };
+
+    std::thread controller{forwarder};
+    const auto exec_time = RunParallel(kThreadNum, mt_worker);
+    controller.join();
+
+    [[maybe_unused]] const auto &[leaf_smos, inner_smos] = GetSMOCounts();
+    std::cout << "[  APPEND  ] keys=" << kKeyNum                         //
+              << ", writers=" << kWriterNum                              //
+              << ", readers=" << kReaderNum                              //
+              << ", write_ops_per_sec=" << kKeyNum / write_time          //
+              << ", recent_read_ops_per_sec=" << read_num / exec_time;  //
+    if constexpr (HasSMOCounters<ImplStat>()) {
+      std::cout << ", leaf_smos_per_1k_writes=" << 1E3 * leaf_smos / kKeyNum  //
+                << ", inner_smos_per_1k_writes=" << 1E3 * inner_smos / kKeyNum;
+    }
+    std::cout << std::endl;
+
+    index_ = nullptr;
+    DestroyData();
+  }
+
+  /**
+   * @brief Measure the latency of lookups that depend on the previous ones.
+   *
+   * Each key refers to the ID of the next key by its payload, and all the keys form a
+   * single random cycle. Since the key of a lookup is unknown until the previous lookup
+   * returns, lookups cannot overlap and their latency is exposed. The throughput of
+   * independent random lookups is reported for comparison. Since timers cost as much as
+   * cache misses, throughput and latency percentiles are measured in separate passes.
+   */
+  void
+  MeasureDependentReads()
+  {
+    if constexpr (!std::is_integral_v<Payload> && !std::is_same_v<Payload, uint64_t *>) {
+      GTEST_SKIP();  // payloads must encode the IDs of next keys
+    } else {
+      if (!HasWriteOperation<ImplStat>()) {
+        GTEST_SKIP();
+      }
+
+      constexpr size_t kKeyNum = kMaxKeyNum;
+      PrepareData(kKeyNum);
+      CreateIndex();
+
+      // create a single cycle of keys by Sattolo's algorithm
+      std::vector<size_t> next_ids(kKeyNum);
+      for (size_t i = 0; i < kKeyNum; ++i) {
+        next_ids[i] = i;
+      }
+      std::mt19937_64 rng{kRandomSeed};
+      for (size_t i = kKeyNum - 1; i > 0; --i) {
+        std::uniform_int_distribution<size_t> id_dist{0, i - 1};
+        std::swap(next_ids[i], next_ids[id_dist(rng)]);
+      }
+      auto fill_worker = [&](const size_t w_id) -> void {
+        const auto [begin, end] = GetPartition(kKeyNum, kThreadNum, w_id);
+        for (size_t i = begin; i < end; ++i) {
+          EXPECT_EQ(Write(i, next_ids[i]), 0);
+        }
+      };
+      RunParallel(kThreadNum, fill_worker);
+      epoch_manager_->ForwardGlobalEpoch();
+
+      const auto indep_tput = MeasureReads(kKeyNum);
+      for (const auto snapshot : {false, true}) {
+        // follow the cycle and time each lookup only if a histogram is given
+        auto follow_cycle = [&](const size_t w_id, LatencyHistogram *hist) -> void {
+          const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+          auto id = GetPartition(kKeyNum, kThreadNum, w_id).first;
+          for (size_t i = 0; i < kExecNum; ++i) {
+            const auto &key = keys_[id];
+            const auto start = (hist == nullptr) ? Clock::time_point{} : Clock::now();
+            const auto &read_val =
+                snapshot ? index_->SnapshotRead(key, epoch_guard, protected_epochs, GetLength(key))
+                         : index_->Read(key, GetLength(key));
+            if (hist != nullptr) {
+              hist->Add(std::chrono::duration_cast<Nano>(Clock::now() - start).count());
+            }
+            ASSERT_TRUE(read_val);
+            id = GetPayloadID(read_val.value());
+          }
+        };
+
+        // measure throughput without timers as independent lookups in `MeasureReads`
+        auto mt_worker = [&](const size_t w_id) -> void { follow_cycle(w_id, nullptr); };
+        const auto exec_time = RunParallel(kThreadNum, mt_worker);
+
+        std::vector<LatencyHistogram> hists(kThreadNum);
+        auto timed_worker = [&](const size_t w_id) -> void { follow_cycle(w_id, &hists[w_id]); };
+        RunParallel(kThreadNum, timed_worker);
+
+        LatencyHistogram hist{};
+        for (const auto &h : hists) {
+          hist.Merge(h);
+        }
+        const auto dep_tput = kExecNum * kThreadNum / exec_time;
+        std::cout << "[DEPENDENT ] read=" << (snapshot ? "snapshot" : "latest")  //
+                  << ", keys=" << kKeyNum                                      //
+                  << ", threads=" << kThreadNum                                //
+                  << ", ops_per_sec=" << dep_tput                              //
+                  << ", p50_ns=" << hist.Quantile(0.5)                         //
+                  << ", p99_ns=" << hist.Quantile(0.99)                        //
+                  << ", independent_ops_per_sec=" << indep_tput                //
+                  << ", independent_speedup=" << indep_tput / dep_tput << std::endl;
+      }
+
+      index_ = nullptr;
+      DestroyData();
+    }
+  }
+
+  /**
+   * @brief Measure memory usage and lookups with keys that share prefixes.
+   *
+   * Keys are URL paths, composite keys, and e-mails created by `CreatePrefixStrings` with
+   * `kPrefixDepth` and `kPrefixFanOut`. Each key set is compared with random strings of
+   * the same lengths, so the difference shows the effect of prefixes on node layouts
+   * (e.g., prefix truncation) rather than the effect of key lengths.
+   */
+  void
+  MeasurePrefixKeys()
+  {
+    if constexpr (!IsVarLen<Key>()) {
+      GTEST_SKIP();  // prefixes require variable-length keys
+    } else {
+      if (!HasWriteOperation<ImplStat>()) {
+        GTEST_SKIP();
+      }
+
+      constexpr size_t kKeyNum = kMaxKeyNum;
+      constexpr std::array<std::pair<PrefixPattern, const char *>, 3> kPatterns{
+          std::make_pair(kURLPath, "url_path"),
+          std::make_pair(kComposite, "composite"),
+          std::make_pair(kEmail, "email"),
+      };
+      PrepareData(kKeyNum);
+      auto dummy_keys = std::move(keys_);
+
+      for (const auto &[pattern, name] : kPatterns) {
+        auto prefix_strs = CreatePrefixStrings(kKeyNum, pattern, kPrefixDepth, kPrefixFanOut);
+        auto random_strs = CreateRandomStrings(prefix_strs);
+        size_t total_len = 0;
+        for (const auto &str : prefix_strs) {
+          total_len += str.size();
+        }
+
+        for (auto *strs : {&prefix_strs, &random_strs}) {
+          keys_.clear();
+          for (auto &str : *strs) {
+            keys_.emplace_back(str.data());
+          }
+
+          CreateIndex();
+          const int64_t base_mem = GetMemoryUsage();
+          FillIndex(kKeyNum);
+          const auto mem = static_cast<int64_t>(GetMemoryUsage()) - base_mem;
+          epoch_manager_->ForwardGlobalEpoch();
+          const auto read_tput = MeasureReads(kKeyNum);
+
+          std::cout << "[  PREFIX  ] pattern=" << name                                    //
+                    << ", keys=" << (strs == &prefix_strs ? "prefix" : "random")         //
+                    << ", key_num=" << kKeyNum                                           //
+                    << ", depth=" << kPrefixDepth                                        //
+                    << ", fan_out=" << kPrefixFanOut                                     //
+                    << ", avg_key_len=" << static_cast<double>(total_len) / kKeyNum      //
+                    << ", bytes_per_key=" << static_cast<double>(mem) / kKeyNum          //
+                    << ", read_ops_per_sec=" << read_tput << std::endl;
+          index_ = nullptr;
+        }
+      }
+
+      keys_ = std::move(dummy_keys);
+      DestroyData();
+    }
+  }
+
+  /**
+   * @brief Measure the throughput of lookups interleaved in groups.
+   *
+   * Each worker prefetches the data of `G` keys (and the paths to them if an index has
+   * `Prefetch`; see `HasPrefetchOperation`) and then reads them, so up to `G` cache misses
+   * may be in flight at once. The throughput is compared with plain `Read` loops. If an
+   * index has no `Prefetch` and keys are not pointers, groups are read in the same way as
+   * plain loops, so this benchmark is skipped.
+   */
+  void
+  MeasureInterleavedReads()
+  {
+    if (!HasBulkloadOperation<ImplStat>() && !HasWriteOperation<ImplStat>()) {
+      GTEST_SKIP();
+    }
+    if (!HasPrefetchOperation<ImplStat>() && !std::is_pointer_v<Key>) {
+      GTEST_SKIP() << "interleaving is inactive without prefetching";
+    }
+
+    constexpr size_t kKeyNum = kMaxKeyNum;
+    PrepareData(kKeyNum);
+    CreateIndex();
+    FillIndex(kKeyNum);
+    epoch_manager_->ForwardGlobalEpoch();
+
+    const auto plain_tput = MeasureReads(kKeyNum);
+    for (size_t group_size = 1; group_size <= kMaxGroupSize; group_size *= 2) {
+      auto mt_worker = [&](const size_t w_id) -> void {
+        std::mt19937_64 rng{kRandomSeed + w_id};
+        std::uniform_int_distribution<size_t> id_dist{0, kKeyNum - 1};
+        std::vector<size_t> ids(group_size);
+        for (size_t i = 0; i < kExecNum; i += group_size) {
+          const auto n = std::min(group_size, kExecNum - i);
+          for (size_t j = 0; j < n; ++j) {
+            ids[j] = id_dist(rng);
+            const auto &key = keys_[ids[j]];
+            if constexpr (std::is_pointer_v<Key>) {
+              __builtin_prefetch(key);
+            }
+            if constexpr (HasPrefetchOperation<ImplStat>()) {
+              index_->Prefetch(key, GetLength(key));
+            }
+          }
+          for (size_t j = 0; j < n; ++j) {
+            const auto &key = keys_[ids[j]];
+            const auto &read_val = index_->Read(key, GetLength(key));
+            EXPECT_TRUE(read_val);
+          }
+        }
+      };
+      const auto tput = kExecNum * kThreadNum / RunParallel(kThreadNum, mt_worker);
+
+      std::cout << "[INTERLEAVE] group=" << group_size                                         //
+                << ", keys=" << kKeyNum                                                      //
+                << ", threads=" << kThreadNum                                                //
+                << ", index_prefetch=" << std::boolalpha << HasPrefetchOperation<ImplStat>()  //
+                << std::noboolalpha                                                          //
+                << ", ops_per_sec=" << tput                                                  //
+                << ", speedup=" << tput / plain_tput << std::endl;
+    }
+
+    index_ = nullptr;
+    DestroyData();
+  }
+
+  /**
+   * @brief Measure the latency of random lookups as an index outgrows caches.
+   *
+   * Lookups are measured with `1E5` to `kMaxKeyNum` keys, and the misses of the data TLB
+   * and the last level cache are counted by hardware events if available. Set
+   * `DBGROUP_TEST_BENCH_MAX_KEY_NUM` and `DBGROUP_TEST_USE_HUGEPAGES` for a large-scale
+   * profile.
+   */
+  void
+  MeasureOutOfCacheReads()
+  {
+    if (!HasBulkloadOperation<ImplStat>() && !HasWriteOperation<ImplStat>()) {
+      GTEST_SKIP();
+    }
+
+    for (size_t key_num = kMinKeyNum; key_num <= kMaxKeyNum; key_num *= 10) {  // NOLINT
+      PrepareData(key_num);
+      CreateIndex();
+      const int64_t base_mem = GetMemoryUsage();
+      FillIndex(key_num);
+      epoch_manager_->ForwardGlobalEpoch();
+      const auto mem = static_cast<int64_t>(GetMemoryUsage()) - base_mem;
+
+      std::vector<LatencyHistogram> hists(kThreadNum);
+      auto mt_worker = [&](const size_t w_id) -> void {
+        std::mt19937_64 rng{kRandomSeed + w_id};
+        std::uniform_int_distribution<size_t> id_dist{0, key_num - 1};
+        for (size_t i = 0; i < kExecNum; ++i) {
+          const auto &key = keys_[id_dist(rng)];
+          const auto start = Clock::now();
+          const auto &read_val = index_->Read(key, GetLength(key));
+          const auto end = Clock::now();
+          EXPECT_TRUE(read_val);
+          hists[w_id].Add(std::chrono::duration_cast<Nano>(end - start).count());
+        }
+      };
+
+      // counters must be opened before creating workers to count their events
+      const auto &tlb_misses = PerfCounter::DTLBLoadMisses();
+      const auto &llc_misses = PerfCounter::LLCMisses();
+      tlb_misses->Start();
+      llc_misses->Start();
+      const auto exec_time = RunParallel(kThreadNum, mt_worker);
+      const auto tlb_miss_num = tlb_misses->Stop();
+      const auto llc_miss_num = llc_misses->Stop();
+
+      LatencyHistogram hist{};
+      for (const auto &h : hists) {
+        hist.Merge(h);
+      }
+      const auto ops = static_cast<double>(kExecNum * kThreadNum);
+      std::cout << "[  LARGE   ] keys=" << key_num                          //
+                << ", threads=" << kThreadNum                             //
+                << ", memory_mib=" << mem / kMebi                         //
+                << ", anon_hugepage_mib=" << GetAnonHugePages() / kMebi  //
+                << ", ops_per_sec=" << ops / exec_time                    //
+                << ", p50_ns=" << hist.Quantile(0.5)                      //
+                << ", p99_ns=" << hist.Quantile(0.99)                     //
+                << ", dtlb_misses_per_op=" << tlb_miss_num / ops          //
+                << ", llc_misses_per_op=" << llc_miss_num / ops << std::endl;
+
+      index_ = nullptr;
+      DestroyData();
+    }
+  }
+
+  /**
+   * @brief Measure the throughput of writes, updates, and snapshot reads for a payload
+   * type.
+   *
+   * Since a multi-version index copies a payload into each new version, instantiating
+   * this benchmark with payloads of different sizes (e.g., `Fixed16` to `Fixed1024`)
+   * shows how throughput and memory usage scale with the payload size.
+   */
+  void
+  MeasurePayloadCosts()
+  {
+    if (!HasWriteOperation<ImplStat>()) {
+      GTEST_SKIP();
+    }
+
+    constexpr size_t kKeyNum = kMaxKeyNum;
+    PrepareData(kKeyNum);
+    CreateIndex();
+    const int64_t base_mem = GetMemoryUsage();
+
+    auto write_worker = [&](const size_t w_id) -> void {
+      const auto [begin, end] = GetPartition(kKeyNum, kThreadNum, w_id);
+      for (size_t i = begin; i < end; ++i) {
+        EXPECT_EQ(Write(i, i), 0);
+      }
+    };
+    const auto write_tput = kKeyNum / RunParallel(kThreadNum, write_worker);
+    const auto write_mem = static_cast<int64_t>(GetMemoryUsage()) - base_mem;
+    epoch_manager_->ForwardGlobalEpoch();
+
+    // update random keys, or overwrite them if an index does not support updates
+    auto update_worker = [&](const size_t w_id) -> void {
+      std::mt19937_64 rng{kRandomSeed + w_id};
+      std::uniform_int_distribution<size_t> id_dist{0, kKeyNum - 1};
+      for (size_t i = 0; i < kExecNum; ++i) {
+        const auto id = id_dist(rng);
+        const auto pay_id = (id + 1) % kKeyNum;
+        if constexpr (HasUpdateOperation<ImplStat>()) {
+          EXPECT_EQ(Update(id, pay_id), 0);
+        } else {
+          EXPECT_EQ(Write(id, pay_id), 0);
+        }
+      }
+    };
+    const auto update_tput = kExecNum * kThreadNum / RunParallel(kThreadNum, update_worker);
+    const auto update_mem = static_cast<int64_t>(GetMemoryUsage()) - base_mem;
+    epoch_manager_->ForwardGlobalEpoch();
+
+    auto read_worker = [&](const size_t w_id) -> void {
+      std::mt19937_64 rng{kRandomSeed + w_id};
+      std::uniform_int_distribution<size_t> id_dist{0, kKeyNum - 1};
+      const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+      for (size_t i = 0; i < kExecNum; ++i) {
+        const auto &key = keys_[id_dist(rng)];
+        const auto &read_val =
+            index_->SnapshotRead(key, epoch_guard, protected_epochs, GetLength(key));
+        EXPECT_TRUE(read_val);
+      }
+    };
+    const auto read_tput = kExecNum * kThreadNum / RunParallel(kThreadNum, read_worker);
+
+    std::cout << "[ PAYLOAD  ] bytes=" << GetLength(payloads_.front())         //
+              << ", keys=" << kKeyNum                                          //
+              << ", threads=" << kThreadNum                                    //
+              << ", write_ops_per_sec=" << write_tput                          //
+              << ", update_ops_per_sec=" << update_tput                        //
+              << ", snapshot_read_ops_per_sec=" << read_tput                   //
+              << ", bytes_per_key=" << static_cast<double>(write_mem) / kKeyNum  //
+              << ", bytes_per_key_after_updates="                              //
+              << static_cast<double>(update_mem) / kKeyNum << std::endl;
+
+    index_ = nullptr;
+    DestroyData();
+  }
+
+  /**
+   * @brief Measure the bandwidth of full scans split into contiguous key ranges.
+   *
+   * All the threads scan their own ranges at the same snapshot. Each thread checks that
+   * its records are the keys in the range in order, so the combined results must cover
+   * every key exactly once.
+   */
+  void
+  MeasureParallelScan()
+  {
+    if (!HasScanOperation<ImplStat>()
+        || (!HasBulkloadOperation<ImplStat>() && !HasWriteOperation<ImplStat>())) {
+      GTEST_SKIP();
+    }
+
+    constexpr size_t kKeyNum = kMaxKeyNum;
+    PrepareData(kKeyNum);
+    CreateIndex();
+    FillIndex(kKeyNum);
+
+    epoch_manager_->ForwardGlobalEpoch();
+    const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+
+    for (const auto thread_num : GetThreadNums()) {
+      std::vector<size_t> rec_nums(thread_num, 0);
+      std::vector<size_t> bytes(thread_num, 0);
+      auto mt_worker = [&](const size_t w_id) -> void {
+        const auto [begin_id, end_id] = GetPartition(kKeyNum, thread_num, w_id);
+        const auto begin_key = (w_id == 0) ? ScanKey{} : GetScanKey(begin_id, kRangeClosed);
+        const auto end_key = (end_id == kKeyNum) ? ScanKey{} : GetScanKey(end_id, kRangeOpened);
+
+        size_t id = begin_id;
+        size_t size = 0;
+        auto &&iter = index_->Scan(epoch_guard, protected_epochs, begin_key, end_key);
+        for (; iter; ++iter, ++id) {
+          const auto &[key, payload] = *iter;
+          if (id >= end_id || !IsEqual<KeyComp>(keys_[id], key)) break;
+          size += GetLength(key) + GetLength(payload);
+        }
+        EXPECT_FALSE(iter);
+        EXPECT_EQ(id, end_id);
+
+        rec_nums[w_id] = id - begin_id;
+        bytes[w_id] = size;
+      };
+      const auto exec_time = RunParallel(thread_num, mt_worker);
+
+      size_t rec_num = 0;
+      size_t size = 0;
+      for (size_t i = 0; i < thread_num; ++i) {
+        rec_num += rec_nums[i];
+        size += bytes[i];
+      }
+      EXPECT_EQ(rec_num, kKeyNum);
+
+      std::cout << "[   SCAN   ] keys=" << kKeyNum                 //
+                << ", threads=" << thread_num                     //
+                << ", scan_sec=" << exec_time                     //
+                << ", records_per_sec=" << rec_num / exec_time    //
+                << ", mib_per_sec=" << size / kMebi / exec_time  //
+                << std::endl;
+    }
+
+    index_ = nullptr;
+    DestroyData();
+  }
+
+  /**
+   * @brief Measure short scans starting at random keys.
+   *
+   * The seek cost (i.e., the time from acquiring an epoch guard to reading the first
+   * record) is reported separately from the cost of each following step. The keys of
+   * following records are verified only in every `kVerifyInterval`-th scan, which is
+   * excluded from the step cost.
+   */
+  void
+  MeasureShortScans()
+  {
+    constexpr size_t kVerifyInterval = 64;
+
+    if (!HasScanOperation<ImplStat>()
+        || (!HasBulkloadOperation<ImplStat>() && !HasWriteOperation<ImplStat>())) {
+      GTEST_SKIP();
+    }
+
+    constexpr size_t kKeyNum = kMaxKeyNum;
+    PrepareData(kKeyNum);
+    CreateIndex();
+    FillIndex(kKeyNum);
+    epoch_manager_->ForwardGlobalEpoch();
+
+    for (const size_t scan_len : {1, 10, 100, 1000}) {  // NOLINT
+      const auto scan_num = std::max<size_t>(kExecNum / scan_len, 1);
+      std::vector<LatencyHistogram> seek_hists(kThreadNum);
+      std::vector<uint64_t> step_nanos(kThreadNum, 0);
+      std::vector<size_t> step_nums(kThreadNum, 0);
+      auto mt_worker = [&](const size_t w_id) -> void {
+        std::mt19937_64 rng{kRandomSeed + w_id};
+        std::uniform_int_distribution<size_t> id_dist{0, kKeyNum - scan_len};
+        for (size_t i = 0; i < scan_num; ++i) {
+          const auto begin_id = id_dist(rng);
+          const auto end_id = begin_id + scan_len;
+          const auto begin_key = GetScanKey(begin_id, kRangeClosed);
+          const auto end_key = (end_id < kKeyNum) ? GetScanKey(end_id, kRangeOpened) : ScanKey{};
+
+          const auto start = Clock::now();
+          const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+          auto &&iter = index_->Scan(epoch_guard, protected_epochs, begin_key, end_key);
+          ASSERT_TRUE(iter);
+          const auto &first_rec = *iter;
+          const auto seeked = Clock::now();
+          EXPECT_TRUE(IsEqual<KeyComp>(keys_[begin_id], std::get<0>(first_rec)));
+
+          const auto verify = (i % kVerifyInterval == 0);
+          auto id = begin_id + 1;
+          for (++iter; iter; ++iter, ++id) {
+            [[maybe_unused]] const auto &[key, payload] = *iter;
+            if (verify && (id >= end_id || !IsEqual<KeyComp>(keys_[id], key))) break;
+          }
+          const auto end = Clock::now();
+          EXPECT_EQ(id, end_id);
+
+          seek_hists[w_id].Add(std::chrono::duration_cast<Nano>(seeked - start).count());
+          if (verify) continue;
+          step_nanos[w_id] += std::chrono::duration_cast<Nano>(end - seeked).count();
+          step_nums[w_id] += id - begin_id - 1;
+        }
+      };
+      const auto exec_time = RunParallel(kThreadNum, mt_worker);
+
+      LatencyHistogram seek_hist{};
+      uint64_t step_nano = 0;
+      size_t step_num = 0;
+      for (size_t i = 0; i < kThreadNum; ++i) {
+        seek_hist.Merge(seek_hists[i]);
+        step_nano += step_nanos[i];
+        step_num += step_nums[i];
+      }
+
+      std::cout << "[SHORT SCAN] length=" << scan_len                                   //
+                << ", threads=" << kThreadNum                                          //
+                << ", scans_per_sec=" << scan_num * kThreadNum / exec_time             //
+                << ", seek_p50_us=" << seek_hist.Quantile(0.5) / 1000.0                // NOLINT
+                << ", seek_p99_us=" << seek_hist.Quantile(0.99) / 1000.0               // NOLINT
+                << ", step_ns=" << (step_num > 0 ? 1.0 * step_nano / step_num : 0.0)  //
+                << std::endl;
+    }
+
+    index_ = nullptr;
+    DestroyData();
+  }
+
+  /**
+   * @brief Measure queries for the last N records before random keys.
+   *
+   * Reverse scans are compared with forward scans that buffer the records of the same
+   * range and read them in reverse order.
+   */
+  void
+  MeasureReverseScans()
+  {
+    if (!HasScanOperation<ImplStat>()
+        || (!HasBulkloadOperation<ImplStat>() && !HasWriteOperation<ImplStat>())) {
+      GTEST_SKIP();
+    }
+
+    constexpr size_t kKeyNum = kMaxKeyNum;
+    PrepareData(kKeyNum);
+    CreateIndex();
+    FillIndex(kKeyNum);
+    epoch_manager_->ForwardGlobalEpoch();
+
+    for (const auto descending : {false, true}) {
+      if (descending && !HasReverseScanOperation<ImplStat>()) continue;
+
+      for (const size_t scan_len : {10, 100, 1000}) {  // NOLINT
+        const auto scan_num = std::max<size_t>(kExecNum / scan_len, 1);
+        auto mt_worker = [&](const size_t w_id) -> void {
+          std::mt19937_64 rng{kRandomSeed + w_id};
+          std::uniform_int_distribution<size_t> id_dist{scan_len - 1, kKeyNum - 1};
+          for (size_t i = 0; i < scan_num; ++i) {
+            const auto end_id = id_dist(rng);
+            const auto begin_id = end_id + 1 - scan_len;
+            const auto begin_key = GetScanKey(begin_id, kRangeClosed);
+            const auto end_key = GetScanKey(end_id, kRangeClosed);
+
+            auto id = end_id + 1;
+            const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+            if (descending) {
+              if constexpr (HasReverseScanOperation<ImplStat>()) {
+                auto &&iter =
+                    index_->ReverseScan(epoch_guard, protected_epochs, begin_key, end_key);
+                for (; iter; ++iter) {
+                  const auto &[key, payload] = *iter;
+                  if (id <= begin_id || !IsEqual<KeyComp>(keys_[id - 1], key)) break;
+                  --id;
+                }
+              }
+            } else {
+              auto &&iter = index_->Scan(epoch_guard, protected_epochs, begin_key, end_key);
+              std::vector<std::decay_t<decltype(*iter)>> records{};
+              for (; iter; ++iter) {
+                records.emplace_back(*iter);
+              }
+              for (auto &&rec = records.crbegin(); rec != records.crend(); ++rec) {
+                const auto &[key, payload] = *rec;
+                if (id <= begin_id || !IsEqual<KeyComp>(keys_[id - 1], key)) break;
+                --id;
+              }
+            }
+            EXPECT_EQ(id, begin_id);
+          }
+        };
+        const auto exec_time = RunParallel(kThreadNum, mt_worker);
+
+        std::cout << "[ REV SCAN ] method=" << (descending ? "reverse" : "buffered_forward")  //
+                  << ", length=" << scan_len                                                 //
+                  << ", threads=" << kThreadNum                                              //
+                  << ", scans_per_sec=" << scan_num * kThreadNum / exec_time << std::endl;
+      }
+    }
+
+    index_ = nullptr;
+    DestroyData();
+  }
+
+  /**
+   * @brief Measure scans over large ranges that are abandoned after k records.
+   *
+   * This benchmark runs with a single thread to attribute memory usage to iterators. The
+   * memory held by an iterator after reading its first record reveals how many records
+   * the index prefetches or copies beyond what a consumer reads. Since reading allocator
+   * statistics is much slower than a short scan, memory is measured in a separate pass
+   * after the timed one, which also checks that abandoned iterators release it.
+   */
+  void
+  MeasureAbandonedScans()
+  {
+    constexpr size_t kMemSampleNum = 32;
+
+    if (!HasScanOperation<ImplStat>()
+        || (!HasBulkloadOperation<ImplStat>() && !HasWriteOperation<ImplStat>())) {
+      GTEST_SKIP();
+    }
+
+    constexpr size_t kKeyNum = kMaxKeyNum;
+    const auto scan_num = std::max<size_t>(kExecNum / 100, 1);  // NOLINT
+    PrepareData(kKeyNum);
+    CreateIndex();
+    FillIndex(kKeyNum);
+    epoch_manager_->ForwardGlobalEpoch();
+
+    for (const size_t rec_num : {1, 10, 100, 1000}) {  // NOLINT
+      // abandon an iterator without reaching the end of its range
+      auto scan_and_abandon = [&](const size_t begin_id, auto &&on_seek) -> void {
+        const auto begin_key = GetScanKey(begin_id, kRangeClosed);
+        const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+        auto &&iter = index_->Scan(epoch_guard, protected_epochs, begin_key, ScanKey{});
+        ASSERT_TRUE(iter);
+        on_seek();
+
+        auto id = begin_id;
+        for (; iter && id < begin_id + rec_num; ++iter, ++id) {
+          const auto &[key, payload] = *iter;
+          if (!IsEqual<KeyComp>(keys_[id], key)) break;
+        }
+        EXPECT_EQ(id, begin_id + rec_num);
+      };
+
+      auto worker = [&]([[maybe_unused]] const size_t w_id) -> void {
+        std::mt19937_64 rng{kRandomSeed};
+        std::uniform_int_distribution<size_t> id_dist{0, kKeyNum / 2};
+        for (size_t i = 0; i < scan_num; ++i) {
+          scan_and_abandon(id_dist(rng), [] {});
+        }
+      };
+      const auto exec_time = RunParallel(1, worker);
+
+      std::mt19937_64 rng{kRandomSeed};
+      std::uniform_int_distribution<size_t> id_dist{0, kKeyNum / 2};
+      const auto sample_num = std::min(scan_num, kMemSampleNum);
+      scan_and_abandon(id_dist(rng), [] {});  // warm up thread-local data of this thread
+      int64_t held_mem = 0;
+      int64_t unreleased_mem = 0;
+      for (size_t i = 0; i < sample_num; ++i) {
+        const auto base_mem = static_cast<int64_t>(GetMemoryUsage());
+        scan_and_abandon(id_dist(rng), [&] {
+          held_mem += static_cast<int64_t>(GetMemoryUsage()) - base_mem;
+        });
+        unreleased_mem += static_cast<int64_t>(GetMemoryUsage()) - base_mem;
+      }
+      if constexpr (kHasAllocatorStats) {
+        EXPECT_LE(unreleased_mem, 0) << "abandoned iterators did not release memory";
+      }
+
+      std::cout << "[  LIMIT   ] k=" << rec_num                                          //
+                << ", scans=" << scan_num                                                //
+                << ", us_per_scan=" << exec_time * 1E6 / scan_num                        // NOLINT
+                << ", held_kib_per_scan=" << held_mem / 1024.0 / sample_num              // NOLINT
+                << ", unreleased_kib_per_scan=" << unreleased_mem / 1024.0 / sample_num  // NOLINT
+                << std::endl;
+    }
+
+    index_ = nullptr;
+    DestroyData();
+  }
+
+  /**
+   * @brief Measure paginated scans that continue from the last key of each page.
+   *
+   * Re-seeking one iterator is compared with tearing down the iterator and calling
+   * `Scan` with a new epoch guard for each page.
+   */
+  void
+  MeasurePaginatedScans()
+  {
+    constexpr size_t kPageNum = 100;
+
+    if (!HasScanOperation<ImplStat>()
+        || (!HasBulkloadOperation<ImplStat>() && !HasWriteOperation<ImplStat>())) {
+      GTEST_SKIP();
+    }
+
+    constexpr size_t kKeyNum = kMaxKeyNum;
+    PrepareData(kKeyNum);
+    CreateIndex();
+    FillIndex(kKeyNum);
+    epoch_manager_->ForwardGlobalEpoch();
+
+    for (const auto reseek : {false, true}) {
+      if (reseek && !HasIteratorSeekOperation<ImplStat>()) continue;
+
+      for (const size_t page_size : {10, 100}) {  // NOLINT
+        const auto scan_num = std::max<size_t>(kExecNum / (kPageNum * page_size), 1);
+        auto mt_worker = [&](const size_t w_id) -> void {
+          std::mt19937_64 rng{kRandomSeed + w_id};
+          std::uniform_int_distribution<size_t> id_dist{0, kKeyNum - kPageNum * page_size};
+          for (size_t i = 0; i < scan_num; ++i) {
+            const auto begin_id = id_dist(rng);
+            const auto end_id = begin_id + kPageNum * page_size;
+            auto id = begin_id;
+            auto read_page = [&](auto &iter) -> bool {
+              const auto prev_id = id;
+              for (size_t j = 0; iter && j < page_size; ++iter, ++j, ++id) {
+                const auto &[key, payload] = *iter;
+                if (!IsEqual<KeyComp>(keys_[id], key)) return false;
+              }
+              return id > prev_id;  // stop paging on a wrong or empty page
+            };
+
+            if (reseek) {
+              if constexpr (HasIteratorSeekOperation<ImplStat>()) {
+                const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+                const auto begin_key = GetScanKey(begin_id, kRangeClosed);
+                auto &&iter = index_->Scan(epoch_guard, protected_epochs, begin_key, ScanKey{});
+                auto progress = read_page(iter);
+                while (progress && id < end_id) {
+                  iter.Seek(*GetScanKey(id - 1, kRangeOpened));
+                  progress = read_page(iter);
+                }
+              }
+            } else {
+              for (bool progress = true; progress && id < end_id;) {
+                const auto begin_key = (id == begin_id) ? GetScanKey(id, kRangeClosed)
+                                                        : GetScanKey(id - 1, kRangeOpened);
+                const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+                auto &&iter = index_->Scan(epoch_guard, protected_epochs, begin_key, ScanKey{});
+                progress = read_page(iter);
+              }
+            }
+            EXPECT_EQ(id, end_id);
+          }
+        };
+        const auto exec_time = RunParallel(kThreadNum, mt_worker);
+
+        std::cout << "[ PAGINATE ] method=" << (reseek ? "reseek" : "rescan")  //
+                  << ", page_size=" << page_size                               //
+                  << ", threads=" << kThreadNum                                //
+                  << ", pages_per_sec=" << scan_num * kPageNum * kThreadNum / exec_time
+                  << std::endl;
+      }
+    }
+
+    index_ = nullptr;
+    DestroyData();
+  }
+
+  /**
+   * @brief Run a fixed set of workloads and record their throughput for comparison.
+   *
+   * The workloads use the same seeds for every index, so the results of typed tests with
+   * the same key/payload types are output as a table at the exit of a process (see
+   * `ComparisonTable`).
+   */
+  void
+  MeasureComparableWorkloads()
+  {
+    if (!HasWriteOperation<ImplStat>()) {
+      GTEST_SKIP();
+    }
+
+    constexpr size_t kKeyNum = kMaxKeyNum;
+    const auto &index_name = GetTypeName<Index_t>();
+    auto record = [&](const char *workload, const double ops_per_sec) -> void {
+      const auto &group = std::string{"workload="} + workload                    //
+                          + ", keys=" + GetTypeName<typename IndexInfo::Key>()  //
+                          + ", payloads=" + GetTypeName<typename IndexInfo::Payload>()
+                          + ", records=" + std::to_string(kKeyNum)  //
+                          + ", threads=" + std::to_string(kThreadNum);
+      ComparisonTable::Record(group, index_name, ops_per_sec);
+    };
+
+    PrepareData(kKeyNum);
+    CreateIndex();
+
+    auto write_worker = [&](const size_t w_id) -> void {
+      const auto [begin, end] = GetPartition(kKeyNum, kThreadNum, w_id);
+      for (size_t i = begin; i < end; ++i) {
+        EXPECT_EQ(Write(i, i), 0);
+      }
+    };
+    record("write", kKeyNum / RunParallel(kThreadNum, write_worker));
+    epoch_manager_->ForwardGlobalEpoch();
+
+    record("read", MeasureReads(kKeyNum));
+
+    if constexpr (HasScanOperation<ImplStat>()) {
+      const auto scan_num = kExecNum / kCompareScanLength;
+      auto scan_worker = [&](const size_t w_id) -> void {
+        std::mt19937_64 rng{kRandomSeed + w_id};
+        std::uniform_int_distribution<size_t> id_dist{0, kKeyNum - kCompareScanLength};
+        for (size_t i = 0; i < scan_num; ++i) {
+          const auto begin_id = id_dist(rng);
+          const auto end_id = begin_id + kCompareScanLength;
+          const auto begin_key = GetScanKey(begin_id, kRangeClosed);
+          const auto end_key = (end_id < kKeyNum) ? GetScanKey(end_id, kRangeOpened) : ScanKey{};
+
+          const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+          size_t rec_num = 0;
+          for (auto &&iter = index_->Scan(epoch_guard, protected_epochs, begin_key, end_key);
+               iter; ++iter) {
+            ++rec_num;
+          }
+          EXPECT_EQ(rec_num, kCompareScanLength);
+        }
+      };
+      record("scan_100", scan_num * kThreadNum / RunParallel(kThreadNum, scan_worker));
+    }
+
+    auto update_worker = [&](const size_t w_id) -> void {
+      std::mt19937_64 rng{kRandomSeed + w_id};
+      std::uniform_int_distribution<size_t> id_dist{0, kKeyNum - 1};
+      for (size_t i = 0; i < kExecNum; ++i) {
+        const auto id = id_dist(rng);
+        EXPECT_EQ(Write(id, (id + 1) % kKeyNum), 0);
+      }
+    };
+    record("overwrite", kExecNum * kThreadNum / RunParallel(kThreadNum, update_worker));
+
+    index_ = nullptr;
+    DestroyData();
+  }
+
+  /*####################################################################################
+   * Internal member variables
+   *##################################################################################*/
+
+  /// actual keys
+  std::vector<Key> keys_{};
+
+  /// actual payloads
+  std::vector<Payload> payloads_{};
+
+  /// an index for benchmarking
+  std::unique_ptr<Index_t> index_{nullptr};
+
+  // an epoch manager for multi-version
+  std::shared_ptr<EpochManager> epoch_manager_{nullptr};
+};
+
+}  // namespace dbgroup::index::test
+
+#endif  // INDEX_FIXTURES_INDEX_BENCHMARK_FIXTURE_HPP
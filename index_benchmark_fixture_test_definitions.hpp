@@ -0,0 +1,102 @@
+/*--------------------------------------------------------------------------------------
+ * Bulkload operation
+ *------------------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexBenchmarkFixture, BulkloadScalesWithThreadsAndKeys)
+{
+  TestFixture::MeasureBulkloadScaling();
+}
+
+TYPED_TEST(IndexBenchmarkFixture, StreamingBulkloadReducesPeakMemory)
+{
+  TestFixture::MeasureStreamingBulkload();
+}
+
+/*--------------------------------------------------------------------------------------
+ * Memory footprint
+ *------------------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexBenchmarkFixture, MemoryFootprintPerKey)
+{
+  TestFixture::MeasureMemoryFootprint();
+}
+
+/*--------------------------------------------------------------------------------------
+ * Payload size
+ *------------------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexBenchmarkFixture, PayloadSizeScalesWriteAndReadCosts)
+{
+  TestFixture::MeasurePayloadCosts();
+}
+
+/*--------------------------------------------------------------------------------------
+ * Write operation
+ *------------------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexBenchmarkFixture, MonotonicIngestContendsOnRightEdge)
+{
+  TestFixture::MeasureMonotonicIngest();
+}
+
+/*--------------------------------------------------------------------------------------
+ * Read operation
+ *------------------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexBenchmarkFixture, DependentReadsExposeLookupLatency)
+{
+  TestFixture::MeasureDependentReads();
+}
+
+TYPED_TEST(IndexBenchmarkFixture, PrefixKeysCompareWithRandomStrings)
+{
+  TestFixture::MeasurePrefixKeys();
+}
+
+TYPED_TEST(IndexBenchmarkFixture, InterleavedReadsOverlapCacheMisses)
+{
+  TestFixture::MeasureInterleavedReads();
+}
+
+TYPED_TEST(IndexBenchmarkFixture, OutOfCacheReadsReportTLBMisses)
+{
+  TestFixture::MeasureOutOfCacheReads();
+}
+
+/*--------------------------------------------------------------------------------------
+ * Scan operation
+ *------------------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexBenchmarkFixture, ParallelFullScanCoversEachKeyOnce)
+{
+  TestFixture::MeasureParallelScan();
+}
+
+TYPED_TEST(IndexBenchmarkFixture, ShortScansSeparateSeekAndStepCosts)
+{
+  TestFixture::MeasureShortScans();
+}
+
+TYPED_TEST(IndexBenchmarkFixture, ReverseScansReturnLatestRecords)
+{
+  TestFixture::MeasureReverseScans();
+}
+
+TYPED_TEST(IndexBenchmarkFixture, AbandonedScansOnlyPayForConsumedRecords)
+{
+  TestFixture::MeasureAbandonedScans();
+}
+
+TYPED_TEST(IndexBenchmarkFixture, PaginatedScansReuseIterators)
+{
+  TestFixture::MeasurePaginatedScans();
+}
+
+/*--------------------------------------------------------------------------------------
+ * Comparison of indexes
+ *------------------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexBenchmarkFixture, ComparableWorkloadsAcrossIndexes)
+{
+  TestFixture::MeasureComparableWorkloads();
+}
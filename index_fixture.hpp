@@ -19,6 +19,10 @@
 
 // C++ standard libraries
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
+#include <iostream>
 #include <memory>
 #include <random>
 #include <tuple>
@@ -29,7 +33,9 @@
 #include "gtest/gtest.h"
 
 // local sources
+#include "alloc_tracker.hpp"
 #include "common.hpp"
+#include "metrics.hpp"
 
 namespace dbgroup::index::test
 {
@@ -65,6 +71,7 @@ class IndexFixture : public testing::Test
   static constexpr size_t kRecNumWithLeafSMOs = 1000;
   static constexpr size_t kRecNumWithInternalSMOs = 30000;
   static constexpr size_t kKeyNum = kExecNum + 2;
+  static constexpr size_t kOutlierFactor = 10;
 
   /*####################################################################################
    * Setup/Teardown
@@ -216,8 +223,12 @@ class IndexFixture : public testing::Test
       const auto pay_id = key_id;  // i.e., expect to read first writes.
 
       const auto &key = keys_.at(key_id);
+      [[maybe_unused]] const auto alloc_num = GetAllocationStats().count;
       const auto read_val =
           index_->SnapshotRead(key, epoch_guard, protected_epochs, GetLength(key));
+      if constexpr (kExpectAllocationFreeReads && !IsVarLen<Payload>()) {
+        EXPECT_EQ(GetAllocationStats().count, alloc_num) << "SnapshotRead allocated memory";
+      }
 
       EXPECT_TRUE(read_val);
 
@@ -238,7 +249,11 @@ class IndexFixture : public testing::Test
       const auto pay_id = (write_twice) ? key_id + 1 : key_id;
 
       const auto &key = keys_.at(key_id);
+      [[maybe_unused]] const auto alloc_num = GetAllocationStats().count;
       const auto read_val = index_->Read(key, GetLength(key));
+      if constexpr (kExpectAllocationFreeReads && !IsVarLen<Payload>()) {
+        EXPECT_EQ(GetAllocationStats().count, alloc_num) << "Read allocated memory";
+      }
       if (expect_success) {
         EXPECT_TRUE(read_val);
 
@@ -296,6 +311,59 @@ class IndexFixture : public testing::Test
     }
   }
 
+  void
+  VerifyReverseScan(  //
+      [[maybe_unused]] const ScanKeyRef &begin_ref,
+      [[maybe_unused]] const ScanKeyRef &end_ref)
+  {
+    epoch_manager_->ForwardGlobalEpoch();
+    const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+
+    if constexpr (HasReverseScanOperation<ImplStat>()) {
+      ScanKey begin_key = std::nullopt;
+      size_t begin_pos = 0;
+      if (begin_ref) {
+        auto &&[begin_id, begin_closed] = *begin_ref;
+        const auto &key = keys_.at(begin_id);
+        begin_key.emplace(key, GetLength(key), begin_closed);
+        begin_pos = (begin_closed) ? begin_id : begin_id + 1;
+      }
+
+      ScanKey end_key = std::nullopt;
+      size_t end_pos = kExecNum;  // FillIndex inserts kExecNum records
+      if (end_ref) {
+        auto &&[end_id, end_closed] = *end_ref;
+        const auto &key = keys_.at(end_id);
+        end_key.emplace(key, GetLength(key), end_closed);
+        end_pos = (end_closed) ? end_id + 1 : end_id;
+      }
+
+      auto &&iter = index_->ReverseScan(epoch_guard, protected_epochs, begin_key, end_key);
+      for (; iter; ++iter) {
+        ASSERT_GT(end_pos, begin_pos);
+        --end_pos;
+        const auto &[key, payload] = *iter;
+        EXPECT_TRUE(IsEqual<KeyComp>(keys_.at(end_pos), key));
+        EXPECT_TRUE(IsEqual<PayComp>(payloads_.at(end_pos), payload));
+      }
+      EXPECT_EQ(begin_pos, end_pos);
+    }
+  }
+
+  /**
+   * @return the numbers of leaf and internal SMOs (zeros if an index has no counters).
+   */
+  [[nodiscard]] auto
+  GetSMOCounts() const  //
+      -> std::pair<size_t, size_t>
+  {
+    if constexpr (HasSMOCounters<ImplStat>()) {
+      return index_->GetSMOCounts();
+    } else {
+      return {0, 0};
+    }
+  }
+
   void
   VerifyWrite(  //
       const std::vector<size_t> &target_ids,
@@ -365,8 +433,21 @@ class IndexFixture : public testing::Test
   }
 
   void
-  VerifyBulkload()
+  VerifyBulkload(const bool streaming = false)
   {
+    if constexpr (HasStreamingBulkloadOperation<ImplStat>()) {
+      if (streaming) {
+        const auto &entries = MakeLazyEntryRange<Key, Payload>(
+            kExecNum,  //
+            [&](const size_t i) -> const Key & { return keys_.at(i); },
+            [&](const size_t i) -> const Payload & { return payloads_.at(i); });
+
+        const auto rc = index_->Bulkload(entries, 1);
+        EXPECT_EQ(rc, 0);
+        return;
+      }
+    }
+
     if constexpr (HasBulkloadOperation<ImplStat>()) {
       if constexpr (IsVarLen<Key>() || IsVarLen<Payload>()) {
         std::vector<std::tuple<Key, Payload, size_t, size_t>> entries{};
@@ -407,11 +488,13 @@ class IndexFixture : public testing::Test
   void
   VerifyScanWith(  //
       const bool has_range,
-      const bool closed = true)
+      const bool closed = true,
+      const bool descending = false)
   {
     constexpr auto kRecNum = kRecNumWithInternalSMOs;
 
     if (!HasScanOperation<ImplStat>()                                            //
+        || (descending && !HasReverseScanOperation<ImplStat>())                  //
         || (!HasWriteOperation<ImplStat>() && !HasInsertOperation<ImplStat>()))  //
     {
       GTEST_SKIP();
@@ -427,7 +510,201 @@ class IndexFixture : public testing::Test
     }
 
     FillIndex();
-    VerifyScan(begin_key, end_key);
+    if (descending) {
+      VerifyReverseScan(begin_key, end_key);
+    } else {
+      VerifyScan(begin_key, end_key);
+    }
+
+    DestroyData();
+  }
+
+  void
+  VerifyAbandonedScan(const size_t rec_num)
+  {
+    if (!HasScanOperation<ImplStat>() || !HasWriteOperation<ImplStat>()) {
+      GTEST_SKIP();
+    }
+
+    PrepareData();
+    FillIndex();
+
+    if constexpr (HasScanOperation<ImplStat>()) {
+      epoch_manager_->ForwardGlobalEpoch();
+      const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+      auto &&iter = index_->Scan(epoch_guard, protected_epochs, ScanKey{}, ScanKey{});
+      for (size_t i = 0; i < rec_num; ++i, ++iter) {
+        ASSERT_TRUE(iter);
+        const auto &[key, payload] = *iter;
+        EXPECT_TRUE(IsEqual<KeyComp>(keys_.at(i), key));
+        EXPECT_TRUE(IsEqual<PayComp>(payloads_.at(i), payload));
+      }
+    }  // abandon the iterator before reaching the end of the range
+
+    // the abandoned iterator must not block any writes into the scanned range
+    const auto &target_ids = CreateTargetIDs(kExecNum, kSequential);
+    const auto &begin_ref = std::make_pair(0, kRangeClosed);
+    const auto &end_ref = std::make_pair(kExecNum, kRangeOpened);
+    VerifyWrite(target_ids, kWriteTwice);
+    VerifyRead(target_ids, kExpectSuccess, kWriteTwice);
+    VerifyScan(begin_ref, end_ref, kExpectSuccess, kWriteTwice);
+
+    DestroyData();
+  }
+
+  /**
+   * @brief Read all the records page by page while the next page is updated between
+   * pages.
+   *
+   * A re-seeked iterator keeps its snapshot, so it must return the records before the
+   * updates. In contrast, a new scan for each page uses a newer snapshot, so it must
+   * return the updated records.
+   *
+   * @param page_size the number of records in each page.
+   * @param renew_snapshot a flag for calling `Scan` for each page instead of `Seek`.
+   */
+  void
+  VerifyPaginatedScan(  //
+      const size_t page_size,
+      const bool renew_snapshot)
+  {
+    if (!HasScanOperation<ImplStat>() || !HasWriteOperation<ImplStat>()
+        || (!renew_snapshot && !HasIteratorSeekOperation<ImplStat>())) {
+      GTEST_SKIP();
+    }
+
+    PrepareData();
+    FillIndex();
+    epoch_manager_->ForwardGlobalEpoch();
+
+    if constexpr (HasScanOperation<ImplStat>()) {
+      size_t id = 0;
+      auto read_page = [&](auto &iter, const bool is_updated) -> bool {
+        const auto prev_id = id;
+        for (size_t i = 0; iter && i < page_size && id < kExecNum; ++iter, ++i, ++id) {
+          const auto &[key, payload] = *iter;
+          EXPECT_TRUE(IsEqual<KeyComp>(keys_.at(id), key));
+          EXPECT_TRUE(IsEqual<PayComp>(payloads_.at((is_updated) ? id + 1 : id), payload));
+        }
+        return id > prev_id;  // stop paging if an iterator returns no records
+      };
+      auto update_next_page = [&]() {
+        for (size_t i = id; i < id + page_size && i < kExecNum; ++i) {
+          EXPECT_EQ(Write(i, i + 1), 0);
+        }
+        epoch_manager_->ForwardGlobalEpoch();
+      };
+
+      if (renew_snapshot) {
+        for (bool progress = true; progress && id < kExecNum;) {
+          const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+          ScanKey begin_key = std::nullopt;
+          if (id > 0) {
+            const auto &last_key = keys_.at(id - 1);
+            begin_key.emplace(last_key, GetLength(last_key), kRangeOpened);
+          }
+          auto &&iter = index_->Scan(epoch_guard, protected_epochs, begin_key, ScanKey{});
+          progress = read_page(iter, id > 0);
+          update_next_page();
+        }
+      } else if constexpr (HasIteratorSeekOperation<ImplStat>()) {
+        const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+        auto &&iter = index_->Scan(epoch_guard, protected_epochs, ScanKey{}, ScanKey{});
+        auto progress = read_page(iter, !kWriteTwice);
+        while (progress && id < kExecNum) {
+          update_next_page();
+          const auto &last_key = keys_.at(id - 1);
+          iter.Seek(std::make_tuple(std::cref(last_key), GetLength(last_key), kRangeOpened));
+          progress = read_page(iter, !kWriteTwice);
+        }
+      }
+      EXPECT_EQ(id, kExecNum);
+    }
+
+    DestroyData();
+  }
+
+  /**
+   * @brief Construct an index by sequential writes while measuring each write.
+   *
+   * If `DBGROUP_TEST_REPORT_METRICS` is enabled, latency percentiles are reported for all
+   * the writes and for each kind of SMOs that they caused (only if an index has SMO
+   * counters). A write slower than `kOutlierFactor` times the median is an outlier.
+   *
+   * @param rec_num the number of records to be written.
+   */
+  void
+  VerifyConstructWith(const size_t rec_num)
+  {
+    if (!HasWriteOperation<ImplStat>()) {
+      GTEST_SKIP();
+    }
+
+    PrepareData();
+
+    // latencies of all the writes, ones without SMOs, ones with leaf/internal SMOs
+    constexpr std::array<const char *, 4> kKinds = {"all", "no_smo", "leaf_smo", "inner_smo"};
+    std::array<LatencyHistogram, kKinds.size()> hists{};
+    std::vector<std::pair<uint64_t, size_t>> latencies{};
+    latencies.reserve(rec_num);
+
+    const auto &target_ids = CreateTargetIDs(rec_num, kSequential);
+    for (const auto id : target_ids) {
+      [[maybe_unused]] const auto &[leaf_before, inner_before] = GetSMOCounts();
+      const auto start = std::chrono::steady_clock::now();
+      const auto rc = Write(id, id);
+      const auto end = std::chrono::steady_clock::now();
+      EXPECT_EQ(rc, 0);
+
+      size_t kind = 1;
+      if constexpr (HasSMOCounters<ImplStat>()) {
+        const auto &[leaf_after, inner_after] = GetSMOCounts();
+        if (inner_after > inner_before) {
+          kind = 3;
+        } else if (leaf_after > leaf_before) {
+          kind = 2;
+        }
+      }
+      const auto nano = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+      latencies.emplace_back(nano.count(), kind);
+      hists[0].Add(nano.count());
+      hists[kind].Add(nano.count());
+    }
+
+    const auto &begin_ref = std::make_pair(0, kRangeClosed);
+    const auto &end_ref = std::make_pair(rec_num, kRangeOpened);
+    VerifyRead(target_ids, kExpectSuccess, !kWriteTwice);
+    VerifyScan(begin_ref, end_ref, kExpectSuccess, !kWriteTwice);
+
+    if constexpr (kReportMetrics) {
+      for (size_t i = 0; i < kKinds.size(); ++i) {
+        if (hists[i].Count() == 0 || (i > 0 && !HasSMOCounters<ImplStat>())) continue;
+        std::cout << "[   SMOS   ] records=" << rec_num        //
+                  << ", kind=" << kKinds[i]                    //
+                  << ", writes=" << hists[i].Count()           //
+                  << ", p50_ns=" << hists[i].Quantile(0.5)     //
+                  << ", p99_ns=" << hists[i].Quantile(0.99)    //
+                  << ", p999_ns=" << hists[i].Quantile(0.999)  //
+                  << ", max_ns=" << hists[i].Quantile(1.0) << std::endl;
+      }
+
+      // check whether outliers line up with SMOs
+      const auto threshold = hists[0].Quantile(0.5) * kOutlierFactor;
+      size_t outlier_num = 0;
+      size_t smo_outlier_num = 0;
+      for (const auto &[nano, kind] : latencies) {
+        if (nano <= threshold) continue;
+        ++outlier_num;
+        if (kind > 1) ++smo_outlier_num;
+      }
+      std::cout << "[   SMOS   ] records=" << rec_num        //
+                << ", outlier_threshold_ns=" << threshold  //
+                << ", outliers=" << outlier_num;
+      if constexpr (HasSMOCounters<ImplStat>()) {
+        std::cout << ", outliers_with_smo=" << smo_outlier_num;
+      }
+      std::cout << std::endl;
+    }
 
     DestroyData();
   }
@@ -549,9 +826,11 @@ class IndexFixture : public testing::Test
   void
   VerifyBulkloadWith(  //
       const WriteOperation write_ops,
-      const AccessPattern pattern)
+      const AccessPattern pattern,
+      const bool streaming = false)
   {
     if (!HasBulkloadOperation<ImplStat>()                              //
+        || (streaming && !HasStreamingBulkloadOperation<ImplStat>())   //
         || (write_ops == kWrite && !HasWriteOperation<ImplStat>())     //
         || (write_ops == kInsert && !HasInsertOperation<ImplStat>())   //
         || (write_ops == kUpdate && !HasUpdateOperation<ImplStat>())   //
@@ -568,7 +847,7 @@ class IndexFixture : public testing::Test
     auto expect_success = true;
     auto is_updated = false;
 
-    VerifyBulkload();
+    VerifyBulkload(streaming);
     switch (write_ops) {
       case kWrite:
         VerifyWrite(target_ids, kWriteTwice);
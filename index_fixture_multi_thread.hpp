@@ -22,10 +22,13 @@
 #include <chrono>
 #include <condition_variable>
 #include <functional>
+#include <iostream>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <random>
 #include <shared_mutex>
+#include <string_view>
 #include <thread>
 #include <tuple>
 #include <utility>
@@ -36,6 +39,9 @@
 
 // local sources
 #include "common.hpp"
+#include "metrics.hpp"
+#include "trace.hpp"
+#include "workload.hpp"
 
 namespace dbgroup::index::test
 {
@@ -164,6 +170,28 @@ class IndexMultiThreadFixture : public testing::Test
     }
   }
 
+  void
+  ForwardGlobalEpoch()
+  {
+    epoch_manager_->ForwardGlobalEpoch();
+    if constexpr (kTraceEvents) {
+      TraceRecorder::RecordInstant("ForwardGlobalEpoch", TraceRecorder::kControllerTID);
+    }
+  }
+
+  void
+  WaitForReady()
+  {
+    std::unique_lock lock{x_mtx_};
+    cond_.wait(lock, [this] { return is_ready_; });
+    if constexpr (kTrackAllocations) {
+      RestartAllocationLap();
+    }
+    if constexpr (kTraceEvents) {
+      RestartTraceLap();
+    }
+  }
+
   [[nodiscard]] auto
   CreateTargetIDs(                 //
       const size_t rec_num) const  //
@@ -205,8 +233,7 @@ class IndexMultiThreadFixture : public testing::Test
       }
     }
 
-    std::unique_lock lock{x_mtx_};
-    cond_.wait(lock, [this] { return is_ready_; });
+    WaitForReady();
 
     return target_ids;
   }
@@ -228,50 +255,354 @@ class IndexMultiThreadFixture : public testing::Test
       }
     }
 
-    std::unique_lock lock{x_mtx_};
-    cond_.wait(lock, [this] { return is_ready_; });
+    WaitForReady();
 
     return target_ids;
   }
 
   void
-  RunMT(const std::function<void(size_t)> &func)
+  CountOps(  //
+      [[maybe_unused]] const size_t w_id,
+      [[maybe_unused]] const size_t ops_num = 1)
+  {
+    if constexpr (kReportMetrics) {
+      monitor_.Count(w_id, ops_num);
+      if constexpr (kTrackAllocations) {
+        monitor_.AddAllocations(w_id, LapAllocations());
+      }
+    }
+    if constexpr (kTraceEvents) {
+      TraceOps(phase_, TraceRecorder::GetWorkerTID(w_id));
+    }
+  }
+
+  void
+  PrepareMonitoring([[maybe_unused]] const std::string_view phase)
+  {
+    if constexpr (kReportMetrics) {
+      monitor_.Reset(phase);
+    }
+  }
+
+  void
+  StartMonitoring()
+  {
+    if constexpr (kReportMetrics) {
+      monitor_.Start();
+    }
+  }
+
+  void
+  StopMonitoring()
+  {
+    if constexpr (kReportMetrics) {
+      monitor_.Stop();
+      monitor_.ReportTimeSeries(std::cout);
+      monitor_.ReportFairness(std::cout);
+      if constexpr (kTrackAllocations) {
+        monitor_.ReportAllocations(std::cout);
+      }
+    }
+  }
+
+  [[nodiscard]] auto
+  WithMonitoring(const std::function<void(size_t)> &func)  //
+      -> std::function<void(size_t)>
+  {
+    return [&func, this](const size_t w_id) -> void {
+      if constexpr (kTraceEvents) {
+        RestartTraceLap();  // for workers that do not wait for others
+      }
+      func(w_id);
+      if constexpr (kReportMetrics) {
+        monitor_.Finish(w_id);
+      }
+      if constexpr (kTraceEvents) {
+        TracePhase(phase_, TraceRecorder::GetWorkerTID(w_id));
+      }
+    };
+  }
+
+  void
+  RunWorkers(  //
+      const size_t thread_num,
+      const std::function<void(size_t)> &func,
+      const std::string_view phase)
   {
+    phase_ = phase;
+    PrepareMonitoring(phase);
     std::vector<std::thread> threads{};
-    for (size_t i = 0; i < kThreadNum; ++i) {
-      threads.emplace_back(func, i);
+    for (size_t i = 0; i < thread_num; ++i) {
+      threads.emplace_back(WithMonitoring(func), i);
     }
 
     std::this_thread::sleep_for(std::chrono::milliseconds{kWaitForThreadCreation});
-    std::lock_guard guard{s_mtx_};
-
-    is_ready_ = true;
+    {
+      // wait for workers to prepare their targets, and then release them at once
+      std::lock_guard guard{s_mtx_};
+      std::lock_guard lock{x_mtx_};
+      is_ready_ = true;
+      StartMonitoring();
+      if constexpr (kTraceEvents) {
+        RestartTraceLap();
+      }
+    }
     cond_.notify_all();
 
     for (auto &&t : threads) {
       t.join();
     }
+    StopMonitoring();
+    if constexpr (kTraceEvents) {
+      TracePhase(phase, TraceRecorder::kControllerTID);
+    }
+
+    // reset the flag to synchronize workers in the next phase
+    std::lock_guard lock{x_mtx_};
+    is_ready_ = false;
+  }
+
+  void
+  RunMT(  //
+      const std::function<void(size_t)> &func,
+      const std::string_view phase = "RunMT")
+  {
+    RunWorkers(kThreadNum, func, phase);
   }
 
   void
   RunMTMultiOperation(
       const std::function<void(size_t)> &func_single,  // one thread runs func_single
-      const std::function<void(size_t)> &func_multi)   // and the others run func_multi
+      const std::function<void(size_t)> &func_multi,   // and the others run func_multi
+      const std::string_view phase = "RunMTMultiOperation")
   {
-    std::vector<std::thread> threads{};
-    for (size_t i = 0; i < kThreadNum - 1; ++i) {
-      threads.emplace_back(func_multi, i);
+    auto dispatcher = [&](const size_t w_id) -> void {
+      if (w_id == kThreadNum - 1) {
+        func_single(w_id);
+      } else {
+        func_multi(w_id);
+      }
+    };
+
+    RunWorkers(kThreadNum, dispatcher, phase);
+  }
+
+  /**
+   * @brief Check a read payload in O(log kThreadNum).
+   *
+   * This fixture only writes the first `kThreadNum * 2` test payloads, and test data are
+   * sorted, so a read payload is searched for in them with binary search.
+   *
+   * @param val a read payload.
+   * @retval true if the payload is one of the test payloads written by this fixture.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto
+  IsWrittenPayload(const Payload &val) const  //
+      -> bool
+  {
+    const auto written_num = std::min(payloads_.size(), kThreadNum * 2);
+    return std::binary_search(payloads_.begin(), payloads_.begin() + written_num, val,
+                              PayComp{});
+  }
+
+  /**
+   * @brief Run an operation of a role and check its result.
+   *
+   * Read values must be written payloads and scanned keys must not precede their begin
+   * keys. Failed writes are test failures, but an insert, update, or delete may fail
+   * according to the state of a key, so it only counts as unsuccessful.
+   *
+   * @retval true if the operation succeeded.
+   * @retval false otherwise.
+   */
+  auto
+  RunOperation(  //
+      const WorkerRole &role,
+      const size_t w_id,
+      const size_t key_id)  //
+      -> bool
+  {
+    switch (role.ops) {
+      case kReadOp: {
+        const auto &key = keys_.at(key_id);
+        const auto &read_val = index_->Read(key, GetLength(key));
+        if (!read_val) return false;
+        const auto is_valid = IsWrittenPayload(*read_val);
+        EXPECT_TRUE(is_valid);
+        return is_valid;
+      }
+      case kSnapshotReadOp: {
+        const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+        const auto &key = keys_.at(key_id);
+        const auto &read_val =
+            index_->SnapshotRead(key, epoch_guard, protected_epochs, GetLength(key));
+        if (!read_val) return false;
+        const auto is_valid = IsWrittenPayload(*read_val);
+        EXPECT_TRUE(is_valid);
+        return is_valid;
+      }
+      case kScanOp: {
+        if constexpr (HasScanOperation<ImplStat>()) {
+          const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+          const auto &begin_k = keys_.at(key_id);
+          const auto &begin_key = std::make_tuple(begin_k, GetLength(begin_k), kRangeClosed);
+          const ScanKey end_key = std::nullopt;
+
+          auto is_valid = true;
+          auto &&iter = index_->Scan(epoch_guard, protected_epochs, begin_key, end_key);
+          for (size_t i = 0; iter && i < role.scan_length; ++iter, ++i) {
+            const auto &[key, payload] = *iter;
+            is_valid &= !KeyComp{}(key, begin_k) && IsWrittenPayload(payload);
+          }
+          EXPECT_TRUE(is_valid);
+          return is_valid;
+        }
+        return false;
+      }
+      case kWriteOp: {
+        const auto rc = Write(key_id, w_id % kThreadNum);
+        EXPECT_EQ(rc, 0);
+        return rc == 0;
+      }
+      case kInsertOp:
+        return Insert(key_id, w_id % kThreadNum) == 0;
+      case kUpdateOp:
+        return Update(key_id, w_id % kThreadNum) == 0;
+      case kDeleteOp:
+        return Delete(key_id) == 0;
+      default:
+        ADD_FAILURE() << "the role " << role.name << " has an unknown operation";
+        return false;
     }
-    threads.emplace_back(func_single, kThreadNum - 1);
-    std::this_thread::sleep_for(std::chrono::milliseconds{kWaitForThreadCreation});
-    std::lock_guard guard{s_mtx_};
+  }
 
-    is_ready_ = true;
-    cond_.notify_all();
+  /**
+   * @brief Run worker threads according to a declarative mix of roles.
+   *
+   * Worker IDs are assigned to roles in the given order. Each thread generates target
+   * keys with its role's distribution and paces operations if the role has a target
+   * throughput. In open-loop roles, latency is measured from the intended start time of
+   * each operation, so stalls appear as queueing delay of subsequent operations. The
+   * results only count operations that succeeded.
+   *
+   * @param roles the definitions of roles.
+   * @param phase the name of this phase.
+   * @return the results of each role.
+   */
+  auto
+  RunMTWithRoles(  //
+      const std::vector<WorkerRole> &roles,
+      const std::string_view phase = "RunMTWithRoles")  //
+      -> std::vector<RoleResult>
+  {
+    using Clock = std::chrono::steady_clock;
 
-    for (auto &&t : threads) {
-      t.join();
+    auto get_key_range = [](const WorkerRole &role) -> std::pair<size_t, size_t> {
+      if (role.key_end > 0) return {role.key_begin, role.key_end};
+      return {kThreadNum, (kExecNum + 1) * kThreadNum};
+    };
+
+    std::vector<size_t> role_ids{};
+    std::vector<size_t> first_ids{};
+    for (size_t i = 0; i < roles.size(); ++i) {
+      const auto &role = roles.at(i);
+      const auto [key_begin, key_end] = get_key_range(role);
+      const auto min_key_num = (role.dist == kSequentialKeys) ? role.thread_num : 1;
+      if (key_end < key_begin + min_key_num) {
+        ADD_FAILURE() << "the role " << role.name << " has too few keys for its threads";
+        return {};
+      }
+      first_ids.emplace_back(role_ids.size());
+      role_ids.insert(role_ids.end(), role.thread_num, i);
+    }
+    const auto thread_num = role_ids.size();
+    if (thread_num > kThreadNum) {
+      ADD_FAILURE() << "the number of threads in roles exceeds " << kThreadNum;
+      return {};
+    }
+
+    std::vector<size_t> ops_nums(thread_num, 0);
+    std::vector<double> exec_times(thread_num, 0);
+    std::vector<LatencyHistogram> latencies(thread_num);
+    auto mt_worker = [&](const size_t w_id) -> void {
+      const auto role_id = role_ids.at(w_id);
+      const auto &role = roles.at(role_id);
+      const auto ops_num = (role.ops_num > 0) ? role.ops_num : kExecNum;
+      const auto [key_begin, key_end] = get_key_range(role);
+      ArrivalScheduler scheduler{role.load, role.ops_per_sec / role.thread_num, kRandomSeed + w_id};
+      auto &latency = latencies.at(w_id);
+
+      std::optional<KeyGenerator> key_gen{};
+      {
+        std::shared_lock guard{s_mtx_};
+        key_gen.emplace(role.dist, key_begin, key_end, role.thread_num,
+                        w_id - first_ids.at(role_id), kRandomSeed + w_id);
+      }
+      WaitForReady();
+
+      const auto is_paced = scheduler.IsPaced();
+      const auto is_open_loop = scheduler.IsOpenLoop();
+      size_t success_num = 0;
+      const auto start = Clock::now();
+      auto intended = start;
+      for (size_t i = 0; i < ops_num; ++i) {
+        // keep the schedule from intended start times so that the rate does not drift
+        auto op_start = intended;
+        if (is_paced) {
+          std::this_thread::sleep_until(intended);
+          intended = scheduler.Next(intended);
+        }
+        if (!is_open_loop) op_start = Clock::now();
+
+        success_num += static_cast<size_t>(RunOperation(role, w_id, (*key_gen)()));
+        CountOps(w_id);
+
+        // measure latency from the intended start to include queueing delay in open loops
+        const auto end = Clock::now();
+        latency.Add(std::chrono::duration_cast<std::chrono::nanoseconds>(end - op_start).count());
+      }
+
+      const std::chrono::duration<double> exec_time = Clock::now() - start;
+      ops_nums.at(w_id) = success_num;
+      exec_times.at(w_id) = exec_time.count();
+    };
+
+    RunWorkers(thread_num, mt_worker, phase);
+
+    std::vector<RoleResult> results{};
+    for (size_t i = 0; i < roles.size(); ++i) {
+      const auto &role = roles.at(i);
+      RoleResult result{role.name, role.thread_num};
+      std::vector<double> throughputs{};
+      LatencyHistogram latency{};
+      for (size_t w_id = first_ids.at(i); w_id < first_ids.at(i) + role.thread_num; ++w_id) {
+        result.ops += ops_nums.at(w_id);
+        result.exec_sec = std::max(result.exec_sec, exec_times.at(w_id));
+        const auto exec_time = exec_times.at(w_id);
+        throughputs.emplace_back((exec_time > 0) ? ops_nums.at(w_id) / exec_time : 0);
+        latency.Merge(latencies.at(w_id));
+      }
+      result.ops_per_sec = (result.exec_sec > 0) ? result.ops / result.exec_sec : 0;
+      result.cv = Summarize(throughputs).cv;
+      result.p50_us = latency.Quantile(0.5) / 1000.0;     // NOLINT
+      result.p99_us = latency.Quantile(0.99) / 1000.0;    // NOLINT
+      result.p999_us = latency.Quantile(0.999) / 1000.0;  // NOLINT
+
+      if constexpr (kReportMetrics) {
+        std::cout << "[   ROLE   ] " << phase << "/" << result.name  //
+                  << ": threads=" << result.thread_num              //
+                  << ", ops=" << result.ops                         //
+                  << ", ops_per_sec=" << result.ops_per_sec         //
+                  << ", cv=" << result.cv                           //
+                  << ", p50_us=" << result.p50_us                   //
+                  << ", p99_us=" << result.p99_us                   //
+                  << ", p999_us=" << result.p999_us << std::endl;
+      }
+      results.emplace_back(std::move(result));
     }
+
+    return results;
   }
 
   /*####################################################################################
@@ -283,29 +614,36 @@ class IndexMultiThreadFixture : public testing::Test
   )
   {
     VerifyWrite(!kWriteTwice, kSequential);
-    epoch_manager_->ForwardGlobalEpoch();
+    ForwardGlobalEpoch();
     const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
 
-    auto func_snapshot_read = [&]([[maybe_unused]] size_t _) -> void {
+    auto func_snapshot_read = [&](const size_t w_id) -> void {
       const auto &target_ids = CreateTargetIDs(kExecNum);
+      WaitForReady();
       for (size_t i = kThreadNum /*Somehow, CreateTargetIDs(w_id,pattern) starts from 8*/;
            i < target_ids.size(); ++i) {
         const auto &key = keys_.at(i);
+        [[maybe_unused]] const auto alloc_num = GetAllocationStats().count;
         const auto read_val =
             index_->SnapshotRead(key, epoch_guard, protected_epochs, GetLength(key));
+        if constexpr (kExpectAllocationFreeReads && !IsVarLen<Payload>()) {
+          EXPECT_EQ(GetAllocationStats().count, alloc_num) << "SnapshotRead allocated memory";
+        }
 
         const auto expected_val = payloads_.at(i % kThreadNum);
         const auto actual_val = read_val.value();
         EXPECT_TRUE(IsEqual<PayComp>(expected_val, actual_val));
+        CountOps(w_id);
       }
     };
     std::function<void(size_t)> func_write = [&](const size_t w_id) -> void {
       for (const auto id : CreateTargetIDs(w_id, kSequential)) {
         const auto rc = Write(id, w_id + kThreadNum);
         EXPECT_EQ(rc, 0);
+        CountOps(w_id);
       }
     };
-    RunMTMultiOperation(func_snapshot_read, func_write);
+    RunMTMultiOperation(func_snapshot_read, func_write, "SnapshotRead");
   }
 
   void
@@ -317,7 +655,11 @@ class IndexMultiThreadFixture : public testing::Test
     auto mt_worker = [&](const size_t w_id) -> void {
       for (const auto id : CreateTargetIDs(w_id, pattern)) {
         const auto &key = keys_.at(id);
+        [[maybe_unused]] const auto alloc_num = GetAllocationStats().count;
         const auto &read_val = index_->Read(key, GetLength(key));
+        if constexpr (kExpectAllocationFreeReads && !IsVarLen<Payload>()) {
+          EXPECT_EQ(GetAllocationStats().count, alloc_num) << "Read allocated memory";
+        }
         if (expect_success) {
           ASSERT_TRUE(read_val);
           const auto expected_val = payloads_.at((is_update) ? w_id + kThreadNum : w_id);
@@ -326,10 +668,11 @@ class IndexMultiThreadFixture : public testing::Test
         } else {
           EXPECT_FALSE(read_val);
         }
+        CountOps(w_id);
       }
     };
 
-    RunMT(mt_worker);
+    RunMT(mt_worker, "Read");
   }
 
   void
@@ -337,7 +680,7 @@ class IndexMultiThreadFixture : public testing::Test
       [[maybe_unused]] const bool expect_success,
       [[maybe_unused]] const bool is_update)
   {
-    epoch_manager_->ForwardGlobalEpoch();
+    ForwardGlobalEpoch();
     const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
 
     if constexpr (HasScanOperation<ImplStat>()) {
@@ -350,6 +693,7 @@ class IndexMultiThreadFixture : public testing::Test
         const auto &end_k = keys_.at(end_id);
         const auto &end_key = std::make_tuple(end_k, GetLength(end_k), kRangeOpened);
 
+        WaitForReady();
         auto &&iter = index_->Scan(epoch_guard, protected_epochs, begin_key, end_key);
         if (expect_success) {
           for (; iter; ++iter, ++begin_id) {
@@ -360,31 +704,37 @@ class IndexMultiThreadFixture : public testing::Test
             const auto &[key, payload] = *iter;
             EXPECT_TRUE(IsEqual<KeyComp>(keys_.at(key_id), key));
             EXPECT_TRUE(IsEqual<PayComp>(payloads_.at(val_id), payload));
+            CountOps(w_id);
           }
           EXPECT_EQ(begin_id, end_id);
         }
         EXPECT_FALSE(iter);
       };
 
-      RunMT(mt_worker);
+      RunMT(mt_worker, "Scan");
     }
   }
 
   void
   VerifySnapshotScanWith(  //
       const WriteOperation write_ops,
-      const AccessPattern pattern)
+      const AccessPattern pattern,
+      const bool descending = false)
   {
+    if (descending && !HasReverseScanOperation<ImplStat>()) {
+      GTEST_SKIP();
+    }
+
     VerifyWrite(!kWriteTwice, kSequential);
-    epoch_manager_->ForwardGlobalEpoch();
+    ForwardGlobalEpoch();
 
     const auto &[epoch_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
-    epoch_manager_->ForwardGlobalEpoch();
-    epoch_manager_->ForwardGlobalEpoch();
+    ForwardGlobalEpoch();
+    ForwardGlobalEpoch();
     // Note: GetProtectedEpochs() returns the current epoch E, E-1, and protected epochs in
     // descending order. Forwarding epoch 2 times makes sure that tail of the list is the oldest
     // protected epoch.
-    auto func_full_scan_op = [&]([[maybe_unused]] const size_t _) -> void {
+    auto func_full_scan_op = [&](const size_t w_id) -> void {
       size_t begin_id = kThreadNum + kExecNum * 0;
       const auto &begin_k = keys_.at(begin_id);
       const auto &begin_key = std::make_tuple(begin_k, GetLength(begin_k), kRangeClosed);
@@ -393,6 +743,25 @@ class IndexMultiThreadFixture : public testing::Test
       const auto &end_k = keys_.at(end_id);
       const auto &end_key = std::make_tuple(end_k, GetLength(end_k), kRangeOpened);
 
+      WaitForReady();
+      if (descending) {
+        if constexpr (HasReverseScanOperation<ImplStat>()) {
+          auto &&iter = index_->ReverseScan(epoch_guard, protected_epochs, begin_key, end_key);
+          for (; iter && end_id > begin_id; ++iter) {
+            const auto key_id = --end_id;
+            const auto val_id = key_id % kThreadNum;
+
+            const auto &[key, payload] = *iter;
+            EXPECT_TRUE(IsEqual<KeyComp>(keys_.at(key_id), key));
+            EXPECT_TRUE(IsEqual<PayComp>(payloads_.at(val_id), payload));
+            CountOps(w_id);
+          }
+          EXPECT_FALSE(iter);
+          EXPECT_EQ(begin_id, end_id);
+        }
+        return;
+      }
+
       auto &&iter = index_->Scan(epoch_guard, protected_epochs, begin_key, end_key);
 
       for (; iter; ++iter, ++begin_id) {
@@ -402,6 +771,7 @@ class IndexMultiThreadFixture : public testing::Test
         const auto &[key, payload] = *iter;
         EXPECT_TRUE(IsEqual<KeyComp>(keys_.at(key_id), key));
         EXPECT_TRUE(IsEqual<PayComp>(payloads_.at(val_id), payload));
+        CountOps(w_id);
       }
       EXPECT_EQ(begin_id, end_id);
     };
@@ -413,6 +783,7 @@ class IndexMultiThreadFixture : public testing::Test
           for (const auto id : CreateTargetIDs(w_id, pattern)) {
             const auto rc = Write(id, w_id + kThreadNum);
             EXPECT_EQ(rc, 0);
+            CountOps(w_id);
           }
         };
         break;
@@ -424,6 +795,7 @@ class IndexMultiThreadFixture : public testing::Test
           for (const auto id : CreateTargetIDs(w_id, pattern)) {
             const auto rc = Update(id, w_id + kThreadNum);
             EXPECT_EQ(rc, 0);
+            CountOps(w_id);
           }
         };
         break;
@@ -432,6 +804,7 @@ class IndexMultiThreadFixture : public testing::Test
           for (const auto id : CreateTargetIDs(w_id, pattern)) {
             const auto rc = Delete(id);
             EXPECT_EQ(rc, 0);
+            CountOps(w_id);
           }
         };
         break;
@@ -440,7 +813,7 @@ class IndexMultiThreadFixture : public testing::Test
         break;
     }
 
-    RunMTMultiOperation(func_full_scan_op, func_write_op);
+    RunMTMultiOperation(func_full_scan_op, func_write_op, "SnapshotScan");
   }
 
   void
@@ -452,10 +825,11 @@ class IndexMultiThreadFixture : public testing::Test
       for (const auto id : CreateTargetIDs(w_id, pattern)) {
         const auto rc = Write(id, (is_update) ? w_id + kThreadNum : w_id);
         EXPECT_EQ(rc, 0);
+        CountOps(w_id);
       }
     };
 
-    RunMT(mt_worker);
+    RunMT(mt_worker, "Write");
   }
 
   void
@@ -472,10 +846,11 @@ class IndexMultiThreadFixture : public testing::Test
         } else {
           EXPECT_NE(rc, 0);
         }
+        CountOps(w_id);
       }
     };
 
-    RunMT(mt_worker);
+    RunMT(mt_worker, "Insert");
   }
 
   void
@@ -491,10 +866,11 @@ class IndexMultiThreadFixture : public testing::Test
         } else {
           EXPECT_NE(rc, 0);
         }
+        CountOps(w_id);
       }
     };
 
-    RunMT(mt_worker);
+    RunMT(mt_worker, "Update");
   }
 
   void
@@ -510,17 +886,32 @@ class IndexMultiThreadFixture : public testing::Test
         } else {
           EXPECT_NE(rc, 0);
         }
+        CountOps(w_id);
       }
     };
 
-    RunMT(mt_worker);
+    RunMT(mt_worker, "Delete");
   }
 
   void
-  VerifyBulkload()
+  VerifyBulkload(const bool streaming = false)
   {
+    constexpr size_t kOpsNum = (kExecNum + 1) * kThreadNum;
+    if constexpr (HasStreamingBulkloadOperation<ImplStat>()) {
+      if (streaming) {
+        // each thread of an index dereferences its own copies of iterators
+        const auto &entries = MakeLazyEntryRange<Key, Payload>(
+            kOpsNum - kThreadNum,  //
+            [&](const size_t i) -> const Key & { return keys_.at(i + kThreadNum); },
+            [&](const size_t i) -> const Payload & { return payloads_.at(i % kThreadNum); });
+
+        const auto rc = index_->Bulkload(entries, kThreadNum);
+        EXPECT_EQ(rc, 0);
+        return;
+      }
+    }
+
     if constexpr (HasBulkloadOperation<ImplStat>()) {
-      constexpr size_t kOpsNum = (kExecNum + 1) * kThreadNum;
       if constexpr (IsVarLen<Key>() || IsVarLen<Payload>()) {
         std::vector<std::tuple<Key, Payload, size_t, size_t>> entries{};
         entries.reserve(kOpsNum);
@@ -666,18 +1057,20 @@ class IndexMultiThreadFixture : public testing::Test
       GTEST_SKIP();
     }
 
-    auto read_proc = [&]() -> void {
+    auto read_proc = [&](const size_t w_id) -> void {
       for (const auto id : CreateTargetIDsForConcurrentSMOs()) {
         const auto &key = keys_.at(id);
         const auto &read_val = index_->Read(key, GetLength(key));
         if (read_val) {
           EXPECT_TRUE(IsEqual<PayComp>(payloads_.at(id % kReadThread), read_val.value()));
         }
+        CountOps(w_id);
       }
     };
 
-    auto scan_proc = [&]() -> void {
-      epoch_manager_->ForwardGlobalEpoch();
+    auto scan_proc = [&](const size_t w_id) -> void {
+      WaitForReady();
+      ForwardGlobalEpoch();
       auto &&guard = epoch_manager_->CreateEpochGuard();
 
       Key prev_key{};
@@ -698,6 +1091,7 @@ class IndexMultiThreadFixture : public testing::Test
           } else {
             prev_key = key;
           }
+          CountOps(w_id);
         }
       }
       if constexpr (IsVarLen<Key>()) {
@@ -708,6 +1102,7 @@ class IndexMultiThreadFixture : public testing::Test
     auto write_proc = [&](const size_t w_id) -> void {
       for (const auto id : CreateTargetIDs(w_id, kRandom)) {
         EXPECT_EQ(Write(id, w_id), 0);
+        CountOps(w_id);
       }
       counter += 1;
     };
@@ -715,6 +1110,7 @@ class IndexMultiThreadFixture : public testing::Test
     auto delete_proc = [&](const size_t w_id) -> void {
       for (const auto id : CreateTargetIDs(w_id, kRandom)) {
         EXPECT_EQ(Delete(id), 0);
+        CountOps(w_id);
       }
       counter += 1;
     };
@@ -727,9 +1123,9 @@ class IndexMultiThreadFixture : public testing::Test
 
     auto even_delete_worker = [&](const size_t w_id) -> void {
       if (w_id >= kScanThread) {
-        scan_proc();
+        scan_proc(w_id);
       } else if (w_id >= kReadThread) {
-        read_proc();
+        read_proc(w_id);
       } else if (w_id % 2 == 0) {
         delete_proc(w_id);
       } else {
@@ -739,9 +1135,9 @@ class IndexMultiThreadFixture : public testing::Test
 
     auto odd_delete_worker = [&](const size_t w_id) -> void {
       if (w_id >= kScanThread) {
-        scan_proc();
+        scan_proc(w_id);
       } else if (w_id >= kReadThread) {
-        read_proc();
+        read_proc(w_id);
       } else if (w_id % 2 == 0) {
         write_proc(w_id);
       } else {
@@ -750,22 +1146,145 @@ class IndexMultiThreadFixture : public testing::Test
     };
 
     PrepareData();
-    RunMT(init_worker);
+    RunMT(init_worker, "InitSMOs");
     for (size_t i = 0; i < kRepeatNum; ++i) {
       counter = 0;
-      RunMT(even_delete_worker);
+      RunMT(even_delete_worker, "EvenDeleteSMOs");
       counter = 0;
-      RunMT(odd_delete_worker);
+      RunMT(odd_delete_worker, "OddDeleteSMOs");
     }
     DestroyData();
   }
 
+  void
+  VerifyMixedRoles(const bool with_delete)
+  {
+    constexpr size_t kBeginID = kThreadNum;
+    constexpr size_t kEndID = (kExecNum + 1) * kThreadNum;
+    constexpr size_t kDeleteBeginID = kEndID - (kEndID - kBeginID) / 8;
+    constexpr size_t kScanNum = kExecNum / 100 + 1;
+    constexpr size_t kReaderNum = kThreadNum / 4;
+
+    if (!HasWriteOperation<ImplStat>()                       //
+        || !HasScanOperation<ImplStat>()                     //
+        || (with_delete && !HasDeleteOperation<ImplStat>())  //
+        || kThreadNum < 4)                                   //
+    {
+      GTEST_SKIP();
+    }
+
+    PrepareData();
+    VerifyWrite(!kWriteTwice, kSequential);
+
+    const auto writer_num = kThreadNum - kReaderNum - ((with_delete) ? 2 : 1);
+    std::vector<WorkerRole> roles{
+        {"SnapshotScanner", 1, kScanOp, kUniformKeys, kScanNum, 0, kBeginID, kDeleteBeginID},
+        {"Reader", kReaderNum, kReadOp, kUniformKeys, kExecNum, 0, kBeginID, kDeleteBeginID},
+        {"Writer", writer_num, kWriteOp, kZipfianKeys, kExecNum, 0, kBeginID, kDeleteBeginID},
+    };
+    if (with_delete) {
+      roles.push_back({"BulkDeleter", 1, kDeleteOp, kSequentialKeys, kEndID - kDeleteBeginID, 0,
+                       kDeleteBeginID, kEndID});
+    }
+
+    const auto &results = RunMTWithRoles(roles, "MixedRoles");
+    ASSERT_EQ(results.size(), roles.size());
+    for (size_t i = 0; i < roles.size(); ++i) {
+      EXPECT_EQ(results.at(i).ops, roles.at(i).thread_num * roles.at(i).ops_num);
+    }
+
+    // writers do not touch deleted keys, so only they must be removed
+    for (size_t id = kBeginID; id < kEndID; ++id) {
+      const auto &key = keys_.at(id);
+      const auto &read_val = index_->Read(key, GetLength(key));
+      EXPECT_EQ(static_cast<bool>(read_val), !with_delete || id < kDeleteBeginID);
+    }
+
+    DestroyData();
+  }
+
+  void
+  VerifyAbandonedScans(const size_t rec_num)
+  {
+    constexpr size_t kBeginID = kThreadNum;
+    constexpr size_t kEndID = (kExecNum + 1) * kThreadNum;
+    constexpr size_t kScanNum = kExecNum / 10 + 1;
+    constexpr size_t kScannerNum = kThreadNum / 2;
+    constexpr size_t kWriterNum = kThreadNum - kScannerNum;
+    constexpr size_t kWriteNum = (kEndID - kBeginID) / kWriterNum;
+
+    if (!HasWriteOperation<ImplStat>() || !HasScanOperation<ImplStat>() || kThreadNum < 2) {
+      GTEST_SKIP();
+    }
+
+    PrepareData();
+    VerifyWrite(!kWriteTwice, kSequential);
+
+    // scanners abandon their iterators after reading `rec_num` records
+    WorkerRole scanner{"AbandoningScanner", kScannerNum, kScanOp, kUniformKeys, kScanNum};
+    scanner.key_begin = kBeginID;
+    scanner.key_end = kEndID;
+    scanner.scan_length = rec_num;
+    const std::vector<WorkerRole> roles{
+        scanner,
+        {"Writer", kWriterNum, kWriteOp, kSequentialKeys, kWriteNum, 0, kBeginID, kEndID},
+    };
+    const auto &results = RunMTWithRoles(roles, "AbandonedScans");
+    ASSERT_EQ(results.size(), roles.size());
+    EXPECT_EQ(results.at(0).ops, kScannerNum * kScanNum);
+    EXPECT_EQ(results.at(1).ops, kWriterNum * kWriteNum);
+
+    // each writer overwrites its own partition with its worker ID as a payload
+    for (size_t id = kBeginID; id < kBeginID + kWriterNum * kWriteNum; ++id) {
+      const auto w_id = kScannerNum + (id - kBeginID) / kWriteNum;
+      const auto &key = keys_.at(id);
+      const auto &read_val = index_->Read(key, GetLength(key));
+      ASSERT_TRUE(read_val);
+      EXPECT_TRUE(IsEqual<PayComp>(payloads_.at(w_id), *read_val));
+    }
+
+    DestroyData();
+  }
+
+  void
+  VerifyOpenLoopReads(const LoadModel load)
+  {
+    constexpr size_t kReaderNum = kThreadNum / 2;
+    constexpr size_t kReadNum = kExecNum / 10 + 1;
+    constexpr double kOpenLoopSec = 0.5;
+
+    if (!HasWriteOperation<ImplStat>() || kThreadNum < 2) {
+      GTEST_SKIP();
+    }
+
+    PrepareData();
+    VerifyWrite(!kWriteTwice, kSequential);
+
+    const std::vector<WorkerRole> roles{
+        {"OpenLoopReader", kReaderNum, kReadOp, kUniformKeys, kReadNum,
+         kReaderNum * kReadNum / kOpenLoopSec, 0, 0, 0, load},
+        {"Writer", kThreadNum - kReaderNum, kWriteOp, kUniformKeys},
+    };
+    const auto &results = RunMTWithRoles(roles, "OpenLoopReads");
+    ASSERT_EQ(results.size(), roles.size());
+
+    // the readers cannot exceed their offered load
+    const auto &readers = results.front();
+    EXPECT_EQ(readers.ops, kReaderNum * kReadNum);
+    EXPECT_GE(readers.exec_sec, kOpenLoopSec * 0.9);  // NOLINT
+    EXPECT_LE(readers.p50_us, readers.p999_us);
+
+    DestroyData();
+  }
+
   void
   VerifyBulkloadWith(  //
       const WriteOperation write_ops,
-      const AccessPattern pattern)
+      const AccessPattern pattern,
+      const bool streaming = false)
   {
     if (!HasBulkloadOperation<ImplStat>()                              //
+        || (streaming && !HasStreamingBulkloadOperation<ImplStat>())   //
         || (write_ops == kWrite && !HasWriteOperation<ImplStat>())     //
         || (write_ops == kInsert && !HasInsertOperation<ImplStat>())   //
         || (write_ops == kUpdate && !HasUpdateOperation<ImplStat>())   //
@@ -779,7 +1298,7 @@ class IndexMultiThreadFixture : public testing::Test
     auto expect_success = true;
     auto is_updated = false;
 
-    VerifyBulkload();
+    VerifyBulkload(streaming);
     switch (write_ops) {
       case kWrite:
         VerifyWrite(kWriteTwice, pattern);
@@ -819,6 +1338,12 @@ class IndexMultiThreadFixture : public testing::Test
   /// an index for testing
   std::unique_ptr<Index_t> index_{nullptr};
 
+  /// a monitor for per-thread throughput in multi-threaded phases.
+  PhaseMonitor monitor_{kThreadNum, kSamplingIntervalMilli};
+
+  /// the name of the current multi-threaded phase.
+  std::string_view phase_{};
+
   /// a mutex for notifying worker threads.
   std::mutex x_mtx_{};
 
@@ -14,6 +14,18 @@ TYPED_TEST(IndexMultiThreadFixture, SnapshotScanWithRandomWrite)
 {
   TestFixture::VerifySnapshotScanWith(kWrite, kRandom);
 }
+TYPED_TEST(IndexMultiThreadFixture, SnapshotReverseScanWithSequentialWrite)
+{
+  TestFixture::VerifySnapshotScanWith(kWrite, kSequential, kDescending);
+}
+TYPED_TEST(IndexMultiThreadFixture, SnapshotReverseScanWithReverseWrite)
+{
+  TestFixture::VerifySnapshotScanWith(kWrite, kReverse, kDescending);
+}
+TYPED_TEST(IndexMultiThreadFixture, SnapshotReverseScanWithRandomWrite)
+{
+  TestFixture::VerifySnapshotScanWith(kWrite, kRandom, kDescending);
+}
 // TYPED_TEST(IndexMultiThreadFixture, SnapshotScanWithSequentialUpdate)
 // {
 //   TestFixture::VerifySnapshotScanWith(kUpdate, kSequential);
@@ -256,6 +268,36 @@ TYPED_TEST(IndexMultiThreadFixture, RandomWriteWithDuplicateKeysSucceed)
 //   TestFixture::VerifyConcurrentSMOs();
 // }
 
+/*--------------------------------------------------------------------------------------
+ * Mixed roles
+ *------------------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexMultiThreadFixture, ConcurrentMixedRolesSucceed)
+{
+  TestFixture::VerifyMixedRoles(!kWithDelete);
+}
+
+TYPED_TEST(IndexMultiThreadFixture, AbandonedScansWithConcurrentWritesSucceed)
+{
+  TestFixture::VerifyAbandonedScans(10);  // NOLINT
+}
+
+TYPED_TEST(IndexMultiThreadFixture, OpenLoopReadsAtFixedRateWithConcurrentWrites)
+{
+  TestFixture::VerifyOpenLoopReads(kFixedArrival);
+}
+
+TYPED_TEST(IndexMultiThreadFixture, OpenLoopReadsAtPoissonRateWithConcurrentWrites)
+{
+  TestFixture::VerifyOpenLoopReads(kPoissonArrival);
+}
+
+/* delete is not implemented yet*/
+// TYPED_TEST(IndexMultiThreadFixture, ConcurrentMixedRolesWithBulkDeleteSucceed)
+// {
+//   TestFixture::VerifyMixedRoles(kWithDelete);
+// }
+
 /*--------------------------------------------------------------------------------------
  * Bulkload operation
  *------------------------------------------------------------------------------------*/
@@ -324,3 +366,13 @@ TYPED_TEST(IndexMultiThreadFixture, RandomWriteWithDuplicateKeysSucceed)
 // {
 //   TestFixture::VerifyBulkloadWith(kDelete, kRandom);
 // }
+
+TYPED_TEST(IndexMultiThreadFixture, StreamingBulkloadWithoutAdditionalWriteOperations)
+{
+  TestFixture::VerifyBulkloadWith(kWithoutWrite, kSequential, kStreaming);
+}
+
+TYPED_TEST(IndexMultiThreadFixture, StreamingBulkloadWithRandomWrite)
+{
+  TestFixture::VerifyBulkloadWith(kWrite, kRandom, kStreaming);
+}
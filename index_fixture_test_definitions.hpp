@@ -5,19 +5,19 @@
 TYPED_TEST(IndexFixture, ConstructWithoutSMOs)
 {
   constexpr auto kRecNum = TestFixture::kRecNumWithoutSMOs;
-  TestFixture::VerifyWritesWith(!kWriteTwice, !kWithDelete, kSequential, kRecNum);
+  TestFixture::VerifyConstructWith(kRecNum);
 }
 
 TYPED_TEST(IndexFixture, ConstructWithLeafSMOs)
 {
   constexpr auto kRecNum = TestFixture::kRecNumWithLeafSMOs;
-  TestFixture::VerifyWritesWith(!kWriteTwice, !kWithDelete, kSequential, kRecNum);
+  TestFixture::VerifyConstructWith(kRecNum);
 }
 
 TYPED_TEST(IndexFixture, ConstructWithInternalSMOs)
 {
   constexpr auto kRecNum = TestFixture::kRecNumWithInternalSMOs;
-  TestFixture::VerifyWritesWith(!kWriteTwice, !kWithDelete, kSequential, kRecNum);
+  TestFixture::VerifyConstructWith(kRecNum);
 }
 
 /*--------------------------------------------------------------------------------------
@@ -58,6 +58,36 @@ TYPED_TEST(IndexFixture, ScanWithOpenedRangeExcludeLeftRightEnd)
   TestFixture::VerifyScanWith(kHasRange, kRangeOpened);
 }
 
+TYPED_TEST(IndexFixture, ScanAbandonedAfterFewRecordsAllowsWrites)
+{
+  TestFixture::VerifyAbandonedScan(10);  // NOLINT
+}
+
+TYPED_TEST(IndexFixture, PaginatedScanWithIteratorSeekKeepsSnapshot)
+{
+  TestFixture::VerifyPaginatedScan(100, !kRenewSnapshot);  // NOLINT
+}
+
+TYPED_TEST(IndexFixture, PaginatedScanWithRescanReadsNewerSnapshot)
+{
+  TestFixture::VerifyPaginatedScan(100, kRenewSnapshot);  // NOLINT
+}
+
+TYPED_TEST(IndexFixture, ReverseScanWithoutKeysPerformFullScan)
+{
+  TestFixture::VerifyScanWith(!kHasRange, kRangeClosed, kDescending);
+}
+
+TYPED_TEST(IndexFixture, ReverseScanWithClosedRangeIncludeLeftRightEnd)
+{
+  TestFixture::VerifyScanWith(kHasRange, kRangeClosed, kDescending);
+}
+
+TYPED_TEST(IndexFixture, ReverseScanWithOpenedRangeExcludeLeftRightEnd)
+{
+  TestFixture::VerifyScanWith(kHasRange, kRangeOpened, kDescending);
+}
+
 /*--------------------------------------------------------------------------------------
  * Write operation
  *------------------------------------------------------------------------------------*/
@@ -326,3 +356,13 @@ TYPED_TEST(IndexFixture, BulkloadWithRandomWrite)
 // {
 //   TestFixture::VerifyBulkloadWith(kDelete, kRandom);
 // }
+
+TYPED_TEST(IndexFixture, StreamingBulkloadWithoutAdditionalWriteOperations)
+{
+  TestFixture::VerifyBulkloadWith(kWithoutWrite, kSequential, kStreaming);
+}
+
+TYPED_TEST(IndexFixture, StreamingBulkloadWithRandomWrite)
+{
+  TestFixture::VerifyBulkloadWith(kWrite, kRandom, kStreaming);
+}
@@ -0,0 +1,802 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_FIXTURES_METRICS_HPP
+#define INDEX_FIXTURES_METRICS_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// system libraries
+#include <unistd.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+// local sources
+#include "alloc_tracker.hpp"
+
+namespace dbgroup::index::test
+{
+/*######################################################################################
+ * Constants for measurement
+ *####################################################################################*/
+
+/// the expected size of cache lines to avoid false sharing between counters.
+constexpr size_t kCacheLineSize = 64;
+
+/*######################################################################################
+ * Utility classes for measurement
+ *####################################################################################*/
+
+/**
+ * @brief A summary of sampled values.
+ *
+ */
+struct SummaryStats {
+  /// the minimum value.
+  double min{0};
+
+  /// the maximum value.
+  double max{0};
+
+  /// the mean value.
+  double mean{0};
+
+  /// the coefficient of variation (i.e., the standard deviation divided by the mean).
+  double cv{0};
+};
+
+/*######################################################################################
+ * Utility functions for measurement
+ *####################################################################################*/
+
+/**
+ * @param values sampled values.
+ * @return the summary of the given values.
+ */
+inline auto
+Summarize(const std::vector<double> &values)  //
+    -> SummaryStats
+{
+  SummaryStats stats{};
+  if (values.empty()) return stats;
+
+  const auto [min_it, max_it] = std::minmax_element(values.begin(), values.end());
+  stats.min = *min_it;
+  stats.max = *max_it;
+
+  double sum = 0;
+  for (const auto v : values) {
+    sum += v;
+  }
+  stats.mean = sum / values.size();
+
+  double var = 0;
+  for (const auto v : values) {
+    var += (v - stats.mean) * (v - stats.mean);
+  }
+  var /= values.size();
+  stats.cv = (stats.mean > 0) ? std::sqrt(var) / stats.mean : 0;
+
+  return stats;
+}
+
+/**
+ * @brief A histogram of latency with log-linear buckets.
+ *
+ * Each power of two is split into linear sub-buckets, so the relative error of recorded
+ * values is bounded by the inverse of the number of sub-buckets regardless of their
+ * magnitude.
+ */
+class LatencyHistogram
+{
+ public:
+  /*####################################################################################
+   * Public utility functions
+   *##################################################################################*/
+
+  /**
+   * @param nano a latency in nanoseconds.
+   */
+  void
+  Add(const uint64_t nano)
+  {
+    ++counts_[ToIndex(nano)];
+    ++count_;
+    max_ = std::max(max_, nano);
+  }
+
+  /**
+   * @param other another histogram to be merged into this one.
+   */
+  void
+  Merge(const LatencyHistogram &other)
+  {
+    for (size_t i = 0; i < kBucketNum; ++i) {
+      counts_[i] += other.counts_[i];
+    }
+    count_ += other.count_;
+    max_ = std::max(max_, other.max_);
+  }
+
+  /**
+   * @return the number of recorded values.
+   */
+  [[nodiscard]] auto
+  Count() const  //
+      -> size_t
+  {
+    return count_;
+  }
+
+  /**
+   * @param q a quantile in [0, 1].
+   * @return the upper bound of the bucket containing the given quantile in nanoseconds.
+   */
+  [[nodiscard]] auto
+  Quantile(const double q) const  //
+      -> uint64_t
+  {
+    if (count_ == 0) return 0;
+
+    const auto target = std::max<size_t>(static_cast<size_t>(std::ceil(q * count_)), 1);
+    size_t sum = 0;
+    for (size_t i = 0; i < kBucketNum; ++i) {
+      sum += counts_[i];
+      if (sum >= target) return std::min(ToUpperBound(i), max_);
+    }
+    return max_;
+  }
+
+ private:
+  /*####################################################################################
+   * Internal constants
+   *##################################################################################*/
+
+  /// the number of bits for sub-buckets.
+  static constexpr size_t kSubBucketBits = 4;
+
+  /// the number of sub-buckets in each power of two.
+  static constexpr size_t kSubBucketNum = 1UL << kSubBucketBits;
+
+  /// the total number of buckets to cover 64-bit values.
+  static constexpr size_t kBucketNum = (64 - kSubBucketBits + 1) * kSubBucketNum;
+
+  /*####################################################################################
+   * Internal utility functions
+   *##################################################################################*/
+
+  static constexpr auto
+  ToIndex(const uint64_t val)  //
+      -> size_t
+  {
+    if (val < kSubBucketNum) return val;
+
+    const size_t msb = 63 - __builtin_clzll(val);
+    const auto shift = msb - kSubBucketBits;
+    const auto sub = (val >> shift) & (kSubBucketNum - 1);
+    return (shift + 1) * kSubBucketNum + sub;
+  }
+
+  static constexpr auto
+  ToUpperBound(const size_t idx)  //
+      -> uint64_t
+  {
+    if (idx < kSubBucketNum) return idx;
+
+    const auto shift = idx / kSubBucketNum - 1;
+    const auto sub = idx % kSubBucketNum;
+    return ((kSubBucketNum + sub) << shift) + ((1UL << shift) - 1);
+  }
+
+  /*####################################################################################
+   * Internal member variables
+   *##################################################################################*/
+
+  /// the number of values in each bucket.
+  std::vector<size_t> counts_ = std::vector<size_t>(kBucketNum, 0);
+
+  /// the total number of recorded values.
+  size_t count_{0};
+
+  /// the maximum recorded value.
+  uint64_t max_{0};
+};
+
+/*######################################################################################
+ * Utility functions for memory usage
+ *####################################################################################*/
+
+/**
+ * @return the resident set size of this process in bytes (zero if unavailable).
+ */
+inline auto
+GetResidentMemory()  //
+    -> size_t
+{
+  static const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+  size_t total = 0;
+  size_t resident = 0;
+  std::ifstream statm{"/proc/self/statm"};
+  if (!(statm >> total >> resident)) return 0;
+  return resident * page_size;
+}
+
+/**
+ * @brief Reset the peak resident set size of this process to the current one.
+ *
+ * Free memory cached by the allocator is released in advance as far as possible.
+ *
+ * @retval true if the peak value is reset.
+ * @retval false otherwise (e.g., the kernel does not support `/proc/self/clear_refs`).
+ */
+inline auto
+ResetPeakResidentMemory()  //
+    -> bool
+{
+#if defined(__GLIBC__)
+  malloc_trim(0);  // return cached free memory so that it is not counted in the peak
+#endif
+
+  std::ofstream clear_refs{"/proc/self/clear_refs"};
+  clear_refs << "5";  // reset the peak RSS (i.e., VmHWM)
+  clear_refs.flush();
+  return clear_refs.good();
+}
+
+/**
+ * @return the peak resident set size of this process in bytes (zero if unavailable).
+ */
+inline auto
+GetPeakResidentMemory()  //
+    -> size_t
+{
+  constexpr size_t kKibi = 1024;
+
+  std::ifstream status{"/proc/self/status"};
+  std::string field{};
+  while (status >> field) {
+    if (field == "VmHWM:") {
+      size_t peak = 0;
+      status >> peak;
+      return peak * kKibi;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @return the size of anonymous memory backed by transparent hugepages in bytes.
+ */
+inline auto
+GetAnonHugePages()  //
+    -> size_t
+{
+  constexpr size_t kKibi = 1024;
+
+  std::ifstream smaps{"/proc/self/smaps_rollup"};
+  std::string field{};
+  while (smaps >> field) {
+    if (field == "AnonHugePages:") {
+      size_t size = 0;
+      smaps >> size;
+      return size * kKibi;
+    }
+  }
+  return 0;
+}
+
+/// a flag for allocator statistics, which reflect freed memory exactly (unlike RSS).
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+constexpr bool kHasAllocatorStats = true;
+#else
+constexpr bool kHasAllocatorStats = false;
+#endif
+
+/**
+ * @brief Get the memory usage of this process.
+ *
+ * If the allocator provides statistics (i.e., glibc 2.33 or later), this function returns
+ * the bytes currently allocated by `malloc`, which are not affected by memory cached in
+ * allocator arenas. Otherwise, this function returns the resident set size.
+ *
+ * @return the memory usage in bytes.
+ */
+inline auto
+GetMemoryUsage()  //
+    -> size_t
+{
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  const auto &info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+#else
+  return GetResidentMemory();
+#endif
+}
+
+/*######################################################################################
+ * Utility classes for hardware events
+ *####################################################################################*/
+
+/**
+ * @brief A counter of a hardware event in user space.
+ *
+ * The counter covers the thread that opens it and the threads created after that (e.g.,
+ * worker threads of a benchmark). If the event is unavailable (e.g., `perf_event_open` is
+ * not permitted), the counter always returns NaN.
+ */
+class PerfCounter
+{
+ public:
+  /*####################################################################################
+   * Public constructors and assignment operators
+   *##################################################################################*/
+
+  /**
+   * @param type the type of an event (e.g., `PERF_TYPE_HW_CACHE`).
+   * @param config the configuration of the event.
+   */
+  PerfCounter(  //
+      [[maybe_unused]] const uint32_t type,
+      [[maybe_unused]] const uint64_t config)
+  {
+#if defined(__linux__)
+    perf_event_attr attr{};
+    attr.size = sizeof(perf_event_attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+  }
+
+  PerfCounter(const PerfCounter &) = delete;
+  PerfCounter(PerfCounter &&) = delete;
+
+  auto operator=(const PerfCounter &) -> PerfCounter & = delete;
+  auto operator=(PerfCounter &&) -> PerfCounter & = delete;
+
+  /*####################################################################################
+   * Public destructors
+   *##################################################################################*/
+
+  ~PerfCounter()
+  {
+#if defined(__linux__)
+    if (fd_ >= 0) close(fd_);
+#endif
+  }
+
+  /*####################################################################################
+   * Public builders
+   *##################################################################################*/
+
+  /**
+   * @return a counter of misses in the data TLB by loads.
+   */
+  static auto
+  DTLBLoadMisses()  //
+      -> std::unique_ptr<PerfCounter>
+  {
+#if defined(__linux__)
+    constexpr uint64_t kConfig = PERF_COUNT_HW_CACHE_DTLB               //
+                                 | (PERF_COUNT_HW_CACHE_OP_READ << 8U)  //
+                                 | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+    return std::make_unique<PerfCounter>(PERF_TYPE_HW_CACHE, kConfig);
+#else
+    return std::make_unique<PerfCounter>(0, 0);
+#endif
+  }
+
+  /**
+   * @return a counter of misses in the last level cache.
+   */
+  static auto
+  LLCMisses()  //
+      -> std::unique_ptr<PerfCounter>
+  {
+#if defined(__linux__)
+    return std::make_unique<PerfCounter>(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+#else
+    return std::make_unique<PerfCounter>(0, 0);
+#endif
+  }
+
+  /*####################################################################################
+   * Public utility functions
+   *##################################################################################*/
+
+  /**
+   * @brief Reset and start counting.
+   *
+   */
+  void
+  Start()
+  {
+#if defined(__linux__)
+    if (fd_ < 0) return;
+    ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+  }
+
+  /**
+   * @brief Stop counting.
+   *
+   * @return the number of events since the last start (NaN if unavailable).
+   */
+  auto
+  Stop()  //
+      -> double
+  {
+#if defined(__linux__)
+    if (fd_ < 0) return std::nan("");
+    ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t count = 0;
+    if (read(fd_, &count, sizeof(uint64_t)) != sizeof(uint64_t)) return std::nan("");
+    return static_cast<double>(count);
+#else
+    return std::nan("");
+#endif
+  }
+
+ private:
+  /*####################################################################################
+   * Internal member variables
+   *##################################################################################*/
+
+  /// the file descriptor of an event (negative if unavailable).
+  int fd_{-1};
+};
+
+/*######################################################################################
+ * Utility classes for monitoring
+ *####################################################################################*/
+
+/**
+ * @brief A class for monitoring worker threads in a multi-threaded phase.
+ *
+ * Each worker counts its completed operations, and a background thread samples the
+ * counters at fixed intervals. The sampled values form a per-thread time series of
+ * throughput, which exposes short stalls (e.g., epoch-based garbage collection) hidden
+ * by the average throughput of a phase. In addition, the monitor records when each
+ * worker finished to report the spread of completion time and throughput between
+ * threads (i.e., fairness).
+ */
+class PhaseMonitor
+{
+ public:
+  /*####################################################################################
+   * Type aliases
+   *##################################################################################*/
+
+  using Clock = std::chrono::steady_clock;
+
+  /*####################################################################################
+   * Public constructors and assignment operators
+   *##################################################################################*/
+
+  /**
+   * @param thread_num the maximum number of monitored worker threads.
+   * @param interval_milli the interval between samples in milliseconds.
+   */
+  PhaseMonitor(  //
+      const size_t thread_num,
+      const size_t interval_milli)
+      : interval_{interval_milli}, counters_{std::make_unique<Counter[]>(thread_num)}
+  {
+    prev_.resize(thread_num);
+  }
+
+  PhaseMonitor(const PhaseMonitor &) = delete;
+  PhaseMonitor(PhaseMonitor &&) = delete;
+
+  auto operator=(const PhaseMonitor &obj) -> PhaseMonitor & = delete;
+  auto operator=(PhaseMonitor &&) -> PhaseMonitor & = delete;
+
+  /*####################################################################################
+   * Public destructors
+   *##################################################################################*/
+
+  ~PhaseMonitor() { Stop(); }
+
+  /*####################################################################################
+   * Public utility functions
+   *##################################################################################*/
+
+  /**
+   * @brief Reset counters for a new phase.
+   *
+   * This function must be called before worker threads are created.
+   *
+   * @param phase the name of a monitored phase.
+   */
+  void
+  Reset(const std::string_view phase)
+  {
+    phase_ = phase;
+    samples_.clear();
+    for (size_t i = 0; i < prev_.size(); ++i) {
+      counters_[i].ops.store(0, std::memory_order_relaxed);
+      counters_[i].finish_time = Clock::time_point{};
+      counters_[i].allocs = AllocationStats{};
+      prev_[i] = 0;
+    }
+  }
+
+  /**
+   * @brief Start sampling counters in a background thread.
+   *
+   * This function should be called when worker threads are released.
+   */
+  void
+  Start()
+  {
+    is_running_.store(true, std::memory_order_release);
+    start_time_ = Clock::now();
+    sampler_ = std::thread{[this] {
+      auto next = start_time_ + interval_;
+      while (is_running_.load(std::memory_order_acquire)) {
+        std::this_thread::sleep_until(next);
+        TakeSample();
+        next += interval_;
+      }
+    }};
+  }
+
+  /**
+   * @brief Count completed operations of a worker thread.
+   *
+   * @param w_id the ID of a worker thread.
+   * @param ops_num the number of completed operations.
+   */
+  void
+  Count(  //
+      const size_t w_id,
+      const size_t ops_num = 1)
+  {
+    // only a single worker updates each counter, so a relaxed store is enough
+    auto &ops = counters_[w_id].ops;
+    ops.store(ops.load(std::memory_order_relaxed) + ops_num, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Add memory allocations of a worker thread during its operations.
+   *
+   * @param w_id the ID of a worker thread.
+   * @param stats the statistics of allocations.
+   */
+  void
+  AddAllocations(  //
+      const size_t w_id,
+      const AllocationStats &stats)
+  {
+    auto &allocs = counters_[w_id].allocs;
+    allocs.count += stats.count;
+    allocs.bytes += stats.bytes;
+  }
+
+  /**
+   * @brief Record that a worker thread finished its operations.
+   *
+   * @param w_id the ID of a worker thread.
+   */
+  void
+  Finish(const size_t w_id)
+  {
+    counters_[w_id].finish_time = Clock::now();
+  }
+
+  /**
+   * @brief Stop the background sampler and record the last (partial) interval.
+   *
+   */
+  void
+  Stop()
+  {
+    if (!sampler_.joinable()) return;
+
+    is_running_.store(false, std::memory_order_release);
+    sampler_.join();
+    TakeSample();
+  }
+
+  /**
+   * @brief Output the sampled time series in a CSV format.
+   *
+   * Each line consists of the phase name, the elapsed time at the end of an interval in
+   * milliseconds, the total number of operations in the interval, and the numbers of
+   * operations of each thread in the interval.
+   *
+   * @param out an output stream.
+   */
+  void
+  ReportTimeSeries(std::ostream &out) const
+  {
+    out << "[  SERIES  ] phase,elapsed_ms,total";
+    for (size_t i = 0; i < prev_.size(); ++i) {
+      out << ",t" << i;
+    }
+    out << "\n";
+
+    for (const auto &[elapsed, ops] : samples_) {
+      size_t total = 0;
+      for (const auto n : ops) {
+        total += n;
+      }
+
+      out << "[  SERIES  ] " << phase_ << "," << elapsed << "," << total;
+      for (const auto n : ops) {
+        out << "," << n;
+      }
+      out << "\n";
+    }
+    out.flush();
+  }
+
+  /**
+   * @brief Output the spread of per-thread completion time and throughput.
+   *
+   * Threads without any operations (e.g., idle workers) are ignored.
+   *
+   * @param out an output stream.
+   */
+  void
+  ReportFairness(std::ostream &out) const
+  {
+    std::vector<double> exec_times{};
+    std::vector<double> throughputs{};
+    for (size_t i = 0; i < prev_.size(); ++i) {
+      const auto ops = counters_[i].ops.load(std::memory_order_relaxed);
+      if (ops == 0) continue;
+
+      // workers may start before the sampler starts, so clamp their execution time
+      const auto finish = std::max(counters_[i].finish_time, start_time_);
+      const std::chrono::duration<double> exec_time = finish - start_time_;
+      exec_times.emplace_back(exec_time.count() * 1000);  // NOLINT
+      throughputs.emplace_back((exec_time.count() > 0) ? ops / exec_time.count() : 0);
+    }
+
+    const auto &time = Summarize(exec_times);
+    const auto &tput = Summarize(throughputs);
+    out << "[ FAIRNESS ] " << phase_                       //
+        << ": threads=" << exec_times.size()               //
+        << ", completion_ms(min=" << time.min              //
+        << ", max=" << time.max << ", cv=" << time.cv      //
+        << "), ops_per_sec(min=" << tput.min               //
+        << ", max=" << tput.max << ", cv=" << tput.cv      //
+        << ")" << std::endl;
+  }
+
+  /**
+   * @brief Output the number and bytes of allocations per operation.
+   *
+   * @param out an output stream.
+   */
+  void
+  ReportAllocations(std::ostream &out) const
+  {
+    size_t ops = 0;
+    AllocationStats allocs{};
+    for (size_t i = 0; i < prev_.size(); ++i) {
+      ops += counters_[i].ops.load(std::memory_order_relaxed);
+      allocs.count += counters_[i].allocs.count;
+      allocs.bytes += counters_[i].allocs.bytes;
+    }
+    if (ops == 0) return;
+
+    out << "[  ALLOCS  ] " << phase_                                       //
+        << ": ops=" << ops                                                 //
+        << ", allocs_per_op=" << static_cast<double>(allocs.count) / ops  //
+        << ", bytes_per_op=" << static_cast<double>(allocs.bytes) / ops   //
+        << std::endl;
+  }
+
+ private:
+  /*####################################################################################
+   * Internal classes
+   *##################################################################################*/
+
+  /**
+   * @brief A counter aligned with cache lines to avoid false sharing.
+   *
+   */
+  struct alignas(kCacheLineSize) Counter {
+    /// the number of completed operations.
+    std::atomic_size_t ops{0};
+
+    /// the time when a worker finished its operations.
+    Clock::time_point finish_time{};
+
+    /// allocations during operations.
+    AllocationStats allocs{};
+  };
+
+  /*####################################################################################
+   * Internal utility functions
+   *##################################################################################*/
+
+  void
+  TakeSample()
+  {
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start_time_);
+
+    std::vector<size_t> ops{};
+    ops.reserve(prev_.size());
+    for (size_t i = 0; i < prev_.size(); ++i) {
+      const auto cur = counters_[i].ops.load(std::memory_order_relaxed);
+      ops.emplace_back(cur - prev_[i]);
+      prev_[i] = cur;
+    }
+    samples_.emplace_back(elapsed.count(), std::move(ops));
+  }
+
+  /*####################################################################################
+   * Internal member variables
+   *##################################################################################*/
+
+  /// the interval between samples.
+  std::chrono::milliseconds interval_{};
+
+  /// per-thread counters of completed operations.
+  std::unique_ptr<Counter[]> counters_{nullptr};
+
+  /// the counter values at the last sample.
+  std::vector<size_t> prev_{};
+
+  /// pairs of elapsed milliseconds and per-thread operation counts.
+  std::vector<std::pair<int64_t, std::vector<size_t>>> samples_{};
+
+  /// the name of the current phase.
+  std::string phase_{};
+
+  /// the time when the current phase started.
+  Clock::time_point start_time_{};
+
+  /// a flag for stopping the sampler.
+  std::atomic_bool is_running_{false};
+
+  /// a background thread for sampling.
+  std::thread sampler_{};
+};
+
+}  // namespace dbgroup::index::test
+
+#endif  // INDEX_FIXTURES_METRICS_HPP
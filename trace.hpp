@@ -0,0 +1,290 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_FIXTURES_TRACE_HPP
+#define INDEX_FIXTURES_TRACE_HPP
+
+// C++ standard libraries
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::index::test
+{
+/*######################################################################################
+ * Classes for tracing
+ *####################################################################################*/
+
+/**
+ * @brief A recorder of trace events in the Chrome trace event format.
+ *
+ * Recorded events are written to `kTraceFile` at the exit of a process, so a trace can be
+ * opened with `chrome://tracing` or Perfetto UI. Thread ID zero is reserved for the
+ * controller thread of fixtures, and worker threads use their IDs plus one.
+ */
+class TraceRecorder
+{
+ public:
+  /*####################################################################################
+   * Type aliases
+   *##################################################################################*/
+
+  using Clock = std::chrono::steady_clock;
+
+  /*####################################################################################
+   * Public constants
+   *##################################################################################*/
+
+  /// the thread ID for the controller thread of fixtures.
+  static constexpr size_t kControllerTID = 0;
+
+  /*####################################################################################
+   * Public constructors and assignment operators
+   *##################################################################################*/
+
+  TraceRecorder(const TraceRecorder &) = delete;
+  TraceRecorder(TraceRecorder &&) = delete;
+
+  auto operator=(const TraceRecorder &) -> TraceRecorder & = delete;
+  auto operator=(TraceRecorder &&) -> TraceRecorder & = delete;
+
+  /*####################################################################################
+   * Public destructors
+   *##################################################################################*/
+
+  ~TraceRecorder() { Write(); }
+
+  /*####################################################################################
+   * Public utility functions
+   *##################################################################################*/
+
+  /**
+   * @param w_id the ID of a worker thread.
+   * @return the thread ID in traces.
+   */
+  static constexpr auto
+  GetWorkerTID(const size_t w_id)  //
+      -> size_t
+  {
+    return w_id + 1;
+  }
+
+  /**
+   * @brief Record a span of a thread.
+   *
+   * @param name the name of the span.
+   * @param cat the category of the span (e.g., "phase" and "slow_op").
+   * @param tid the thread ID in traces.
+   * @param begin the time when the span began.
+   * @param end the time when the span ended.
+   */
+  static void
+  RecordSpan(  //
+      const std::string_view name,
+      const std::string_view cat,
+      const size_t tid,
+      const Clock::time_point begin,
+      const Clock::time_point end)
+  {
+    auto &recorder = GetInstance();
+    const std::lock_guard guard{recorder.mtx_};
+    recorder.events_.push_back({std::string{name}, std::string{cat}, 'X', tid, begin, end});
+  }
+
+  /**
+   * @brief Record a global instant event (e.g., forwarding an epoch).
+   *
+   * @param name the name of the event.
+   * @param tid the thread ID in traces.
+   */
+  static void
+  RecordInstant(  //
+      const std::string_view name,
+      const size_t tid)
+  {
+    const auto now = Clock::now();
+    auto &recorder = GetInstance();
+    const std::lock_guard guard{recorder.mtx_};
+    recorder.events_.push_back({std::string{name}, "epoch", 'i', tid, now, now});
+  }
+
+ private:
+  /*####################################################################################
+   * Internal classes
+   *##################################################################################*/
+
+  /**
+   * @brief A recorded trace event.
+   *
+   */
+  struct Event {
+    /// the name of this event.
+    std::string name{};
+
+    /// the category of this event.
+    std::string cat{};
+
+    /// the phase type in the trace event format ('X': complete, 'i': instant).
+    char ph{'X'};
+
+    /// the thread ID in traces.
+    size_t tid{0};
+
+    /// the time when this event began.
+    Clock::time_point begin{};
+
+    /// the time when this event ended.
+    Clock::time_point end{};
+  };
+
+  /*####################################################################################
+   * Internal constructors
+   *##################################################################################*/
+
+  TraceRecorder() = default;
+
+  /*####################################################################################
+   * Internal utility functions
+   *##################################################################################*/
+
+  static auto
+  GetInstance()  //
+      -> TraceRecorder &
+  {
+    static TraceRecorder recorder{};
+    return recorder;
+  }
+
+  static auto
+  ToMicro(const Clock::time_point time)  //
+      -> double
+  {
+    return std::chrono::duration<double, std::micro>{time.time_since_epoch()}.count();
+  }
+
+  /**
+   * @brief Write recorded events to the trace file.
+   *
+   */
+  void
+  Write() const
+  {
+    if (events_.empty()) return;
+
+    std::ofstream out{std::string{kTraceFile}, std::ios::trunc};
+    if (!out) return;
+
+    out << std::fixed << std::setprecision(3);  // timestamps in microseconds
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    std::set<size_t> tids{};
+    for (const auto &event : events_) {
+      out << "\n{\"name\":\"" << event.name << "\",\"cat\":\"" << event.cat  //
+          << "\",\"ph\":\"" << event.ph << "\",\"pid\":1,\"tid\":" << event.tid  //
+          << ",\"ts\":" << ToMicro(event.begin);
+      if (event.ph == 'X') {
+        out << ",\"dur\":" << ToMicro(event.end) - ToMicro(event.begin);
+      } else {
+        out << ",\"s\":\"g\"";  // draw instant events across all the threads
+      }
+      out << "},";
+      tids.insert(event.tid);
+    }
+    for (const auto tid : tids) {
+      const auto &name = (tid == kControllerTID) ? std::string{"controller"}
+                                                 : "worker " + std::to_string(tid - 1);
+      out << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid  //
+          << ",\"args\":{\"name\":\"" << name << "\"}},";
+    }
+    out << "\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+        << "\"args\":{\"name\":\"index fixtures\"}}\n]}\n";
+  }
+
+  /*####################################################################################
+   * Internal member variables
+   *##################################################################################*/
+
+  /// a mutex for concurrent recording.
+  std::mutex mtx_{};
+
+  /// recorded events.
+  std::vector<Event> events_{};
+};
+
+/// the time when this thread began its current phase.
+inline thread_local TraceRecorder::Clock::time_point tls_phase_begin{};
+
+/// the time when this thread completed its last operation.
+inline thread_local TraceRecorder::Clock::time_point tls_last_op{};
+
+/*######################################################################################
+ * Utility functions for tracing
+ *####################################################################################*/
+
+/**
+ * @brief Start tracing a phase of this thread.
+ *
+ */
+inline void
+RestartTraceLap()
+{
+  tls_phase_begin = TraceRecorder::Clock::now();
+  tls_last_op = tls_phase_begin;
+}
+
+/**
+ * @brief Record operations since the last lap as a slow one if they exceed the threshold.
+ *
+ * @param phase the name of the current phase.
+ * @param tid the thread ID in traces.
+ */
+inline void
+TraceOps(  //
+    const std::string_view phase,
+    const size_t tid)
+{
+  const auto now = TraceRecorder::Clock::now();
+  if (now - tls_last_op >= std::chrono::microseconds{kSlowOpThresholdMicro}) {
+    TraceRecorder::RecordSpan(phase, "slow_op", tid, tls_last_op, now);
+  }
+  tls_last_op = now;
+}
+
+/**
+ * @brief Record the current phase of this thread as a span.
+ *
+ * @param phase the name of the current phase.
+ * @param tid the thread ID in traces.
+ */
+inline void
+TracePhase(  //
+    const std::string_view phase,
+    const size_t tid)
+{
+  TraceRecorder::RecordSpan(phase, "phase", tid, tls_phase_begin, TraceRecorder::Clock::now());
+}
+
+}  // namespace dbgroup::index::test
+
+#endif  // INDEX_FIXTURES_TRACE_HPP
@@ -0,0 +1,343 @@
+/*
+ * Copyright 2021 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INDEX_FIXTURES_WORKLOAD_HPP
+#define INDEX_FIXTURES_WORKLOAD_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace dbgroup::index::test
+{
+/*######################################################################################
+ * Constants for workloads
+ *####################################################################################*/
+
+enum KeyDistribution {
+  kUniformKeys,
+  kSequentialKeys,
+  kZipfianKeys,
+};
+
+enum LoadModel {
+  kClosedLoop,
+  kFixedArrival,
+  kPoissonArrival,
+};
+
+enum WorkerOperation {
+  kReadOp,
+  kSnapshotReadOp,
+  kScanOp,
+  kWriteOp,
+  kInsertOp,
+  kUpdateOp,
+  kDeleteOp,
+};
+
+/// the default skew parameter for Zipfian distributions (the same as YCSB).
+constexpr double kZipfSkew = 0.99;
+
+/*######################################################################################
+ * Classes for workloads
+ *####################################################################################*/
+
+/**
+ * @brief A declarative definition of a group of worker threads.
+ *
+ * Worker threads with the same role run the same operation with the same key
+ * distribution. If `key_end` is zero, a fixture uses its whole initialized key range.
+ *
+ * In a closed loop, each thread issues the next operation after the previous one
+ * returns, and `ops_per_sec` only limits the rate. In an open loop, each thread issues
+ * operations on a fixed or Poisson schedule at `ops_per_sec` in total, and latency is
+ * measured from the intended start time to avoid coordinated omission.
+ */
+struct WorkerRole {
+  /// the name of this role for reporting.
+  std::string name{};
+
+  /// the number of threads with this role.
+  size_t thread_num{1};
+
+  /// the operation performed by this role.
+  WorkerOperation ops{kReadOp};
+
+  /// the distribution of target keys.
+  KeyDistribution dist{kUniformKeys};
+
+  /// the number of operations per thread.
+  size_t ops_num{0};
+
+  /// the target throughput of this role in total (zero means unlimited).
+  double ops_per_sec{0};
+
+  /// the begin position of target keys (inclusive).
+  size_t key_begin{0};
+
+  /// the end position of target keys (exclusive).
+  size_t key_end{0};
+
+  /// the maximum number of records read by a scan operation.
+  size_t scan_length{100};  // NOLINT
+
+  /// the model of issuing operations.
+  LoadModel load{kClosedLoop};
+};
+
+/**
+ * @brief The result of a role in a multi-threaded phase.
+ *
+ */
+struct RoleResult {
+  /// the name of a role.
+  std::string name{};
+
+  /// the number of threads with a role.
+  size_t thread_num{0};
+
+  /// the total number of executed operations.
+  size_t ops{0};
+
+  /// the longest execution time of threads in seconds.
+  double exec_sec{0};
+
+  /// the throughput of a role.
+  double ops_per_sec{0};
+
+  /// the coefficient of variation of per-thread throughput.
+  double cv{0};
+
+  /// the median latency in microseconds.
+  double p50_us{0};
+
+  /// the 99th percentile latency in microseconds.
+  double p99_us{0};
+
+  /// the 99.9th percentile latency in microseconds.
+  double p999_us{0};
+};
+
+/**
+ * @brief A class for computing the (intended) start time of each operation.
+ *
+ */
+class ArrivalScheduler
+{
+ public:
+  /*####################################################################################
+   * Type aliases
+   *##################################################################################*/
+
+  using Clock = std::chrono::steady_clock;
+
+  /*####################################################################################
+   * Public constructors and assignment operators
+   *##################################################################################*/
+
+  /**
+   * @param load the model of issuing operations.
+   * @param ops_per_sec the target throughput of this thread (zero means unlimited).
+   * @param seed a random seed for Poisson arrivals.
+   */
+  ArrivalScheduler(  //
+      const LoadModel load,
+      const double ops_per_sec,
+      const size_t seed)
+      : load_{load}, ops_per_sec_{ops_per_sec}, rng_{seed}
+  {
+  }
+
+  /*####################################################################################
+   * Public utility functions
+   *##################################################################################*/
+
+  /**
+   * @retval true if this scheduler limits the rate of operations.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto
+  IsPaced() const  //
+      -> bool
+  {
+    return ops_per_sec_ > 0;
+  }
+
+  /**
+   * @retval true if this scheduler measures latency from intended start time.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto
+  IsOpenLoop() const  //
+      -> bool
+  {
+    return load_ != kClosedLoop && ops_per_sec_ > 0;
+  }
+
+  /**
+   * @param base the intended start time of the previous operation.
+   * @return the time when the next operation should start.
+   */
+  auto
+  Next(const Clock::time_point base)  //
+      -> Clock::time_point
+  {
+    if (ops_per_sec_ <= 0) return base;
+
+    auto interval = 1.0 / ops_per_sec_;
+    if (load_ == kPoissonArrival) {
+      interval = std::exponential_distribution<double>{ops_per_sec_}(rng_);
+    }
+    const std::chrono::duration<double> duration{interval};
+    return base + std::chrono::duration_cast<Clock::duration>(duration);
+  }
+
+ private:
+  /*####################################################################################
+   * Internal member variables
+   *##################################################################################*/
+
+  /// the model of issuing operations.
+  LoadModel load_{kClosedLoop};
+
+  /// the target throughput of this thread.
+  double ops_per_sec_{0};
+
+  /// a random engine for Poisson arrivals.
+  std::mt19937_64 rng_{};
+};
+
+/**
+ * @brief A class for generating target key IDs according to a given distribution.
+ *
+ * For sequential keys, the key range is split into contiguous partitions for each
+ * thread of a role, so the range must have at least as many keys as the threads. For
+ * Zipfian keys, smaller IDs are more frequently selected.
+ */
+class KeyGenerator
+{
+ public:
+  /*####################################################################################
+   * Public constructors and assignment operators
+   *##################################################################################*/
+
+  /**
+   * @param dist a key distribution.
+   * @param begin the begin position of target keys (inclusive).
+   * @param end the end position of target keys (exclusive).
+   * @param thread_num the number of threads sharing the key range.
+   * @param rank the rank of this thread in the threads sharing the key range.
+   * @param seed a random seed.
+   */
+  KeyGenerator(  //
+      const KeyDistribution dist,
+      const size_t begin,
+      const size_t end,
+      const size_t thread_num,
+      const size_t rank,
+      const size_t seed)
+      : dist_{dist}, begin_{begin}, key_num_{end - begin}, rng_{seed}
+  {
+    if (dist_ == kSequentialKeys) {
+      const auto part_num = key_num_ / thread_num;
+      begin_ += part_num * rank;
+      key_num_ = (rank == thread_num - 1) ? key_num_ - part_num * rank : part_num;
+    }
+    assert(key_num_ > 0);  // each thread requires at least one key
+
+    if (dist_ == kZipfianKeys) {
+      // prepare constants for the algorithm of Gray et al. (SIGMOD '94)
+      double zeta_n = 0;
+      for (size_t i = 1; i <= key_num_; ++i) {
+        zeta_n += 1.0 / std::pow(i, kZipfSkew);
+      }
+      const auto zeta_2 = 1.0 + 1.0 / std::pow(2, kZipfSkew);
+      zeta_n_ = zeta_n;
+      alpha_ = 1.0 / (1.0 - kZipfSkew);
+      eta_ = (1.0 - std::pow(2.0 / key_num_, 1.0 - kZipfSkew)) / (1.0 - zeta_2 / zeta_n);
+    }
+  }
+
+  /*####################################################################################
+   * Public utility functions
+   *##################################################################################*/
+
+  /**
+   * @return the next target key ID.
+   */
+  auto
+  operator()()  //
+      -> size_t
+  {
+    switch (dist_) {
+      case kSequentialKeys:
+        return begin_ + (count_++ % key_num_);
+
+      case kZipfianKeys: {
+        const auto u = std::uniform_real_distribution<double>{0, 1}(rng_);
+        const auto uz = u * zeta_n_;
+        if (uz < 1.0) return begin_;
+        if (uz < 1.0 + std::pow(0.5, kZipfSkew)) return begin_ + 1;
+        const auto pos = static_cast<size_t>(key_num_ * std::pow(eta_ * u - eta_ + 1, alpha_));
+        return begin_ + std::min(pos, key_num_ - 1);
+      }
+
+      case kUniformKeys:
+      default:
+        return begin_ + std::uniform_int_distribution<size_t>{0, key_num_ - 1}(rng_);
+    }
+  }
+
+ private:
+  /*####################################################################################
+   * Internal member variables
+   *##################################################################################*/
+
+  /// a key distribution.
+  KeyDistribution dist_{kUniformKeys};
+
+  /// the begin position of target keys.
+  size_t begin_{0};
+
+  /// the number of target keys.
+  size_t key_num_{0};
+
+  /// the number of generated keys for sequential access.
+  size_t count_{0};
+
+  /// a random engine.
+  std::mt19937_64 rng_{};
+
+  /// the zeta value for Zipfian distributions.
+  double zeta_n_{0};
+
+  /// a constant for Zipfian distributions.
+  double alpha_{0};
+
+  /// a constant for Zipfian distributions.
+  double eta_{0};
+};
+
+}  // namespace dbgroup::index::test
+
+#endif  // INDEX_FIXTURES_WORKLOAD_HPP